@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+
+namespace Realms
+{
+    /// <summary>
+    /// A struct describing the progress of opening a local Realm with <see cref="Realm.GetInstanceAsync"/> at a given instant.
+    /// </summary>
+    /// <seealso cref="RealmConfiguration.OnOpenProgress"/>
+    public readonly struct LocalOpenProgress
+    {
+        /// <summary>
+        /// Gets the number of objects scanned for legacy Guid values so far.
+        /// </summary>
+        /// <value>The number of scanned objects, or 0 if the scan hasn't started.</value>
+        public ulong ScannedObjects { get; }
+
+        /// <summary>
+        /// Gets the size of the Realm file when it's about to be compacted.
+        /// </summary>
+        /// <value>The size of the file in bytes, or 0 if the progress isn't reported for a compaction.</value>
+        public ulong CompactedFileSize { get; }
+
+        /// <summary>
+        /// Gets the time elapsed since the Realm started opening.
+        /// </summary>
+        /// <value>The elapsed time.</value>
+        public TimeSpan Elapsed { get; }
+
+        internal LocalOpenProgress(ulong scannedObjects, ulong compactedFileSize, TimeSpan elapsed)
+        {
+            ScannedObjects = scannedObjects;
+            CompactedFileSize = compactedFileSize;
+            Elapsed = elapsed;
+        }
+    }
+}
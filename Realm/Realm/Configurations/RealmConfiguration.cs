@@ -16,6 +16,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
+using System;
 using System.Runtime.InteropServices;
 using System.Threading;
 using System.Threading.Tasks;
@@ -73,6 +74,14 @@ public class RealmConfiguration : RealmConfigurationBase
         /// </value>
         public MigrationCallbackDelegate? MigrationCallback { get; set; }
 
+        /// <summary>
+        /// Gets or sets a callback that is invoked as the Realm is opened with <see cref="Realm.GetInstanceAsync"/>: before
+        /// the file is compacted, before a migration starts and while the file is scanned for legacy Guid values. It's
+        /// invoked on a background thread and is ignored when using <see cref="Realm.GetInstance(RealmConfigurationBase)"/>.
+        /// </summary>
+        /// <value>A callback that will be invoked as the Realm is opened.</value>
+        public Action<LocalOpenProgress>? OnOpenProgress { get; set; }
+
         /// <summary>
         /// Gets or sets the key, used to encrypt the entire Realm. Once set, must be specified each time the file is used.
         /// </summary>
@@ -139,21 +148,55 @@ internal override Task<SharedRealmHandle> CreateHandleAsync(in Configuration con
         {
             // Can't use async/await due to mono inliner bugs
             // If we are on UI thread will be set but often also set on long-lived workers to use Post back to UI thread.
-            if (AsyncHelper.TryGetScheduler(out var scheduler))
+            if (AsyncHelper.TryGetScheduler(out _))
             {
-                // make a local copy because we can't capture in/ref/out parameters in lambdas
-                var config = configuration;
-                return Task.Run(() =>
+                // The Realm is opened on a native background thread, which also runs any compaction, migration or Guid
+                // representation fix, and is then handed back to be resolved on this thread.
+                var tcs = new TaskCompletionSource<ThreadSafeReferenceHandle>(TaskCreationOptions.RunContinuationsAsynchronously);
+                var tcsHandle = GCHandle.Alloc(tcs);
+
+                var onOpenProgress = OnOpenProgress;
+                Func<OperationProgress, bool>? onProgress = onOpenProgress == null ? null : progress =>
+                {
+                    onOpenProgress(new LocalOpenProgress(progress.ProcessedUnits, progress.TotalBytes, progress.Elapsed));
+                    return true;
+                };
+                var progressHandle = onProgress == null ? (GCHandle?)null : GCHandle.Alloc(onProgress);
+
+                var handle = SharedRealmHandle.OpenAsync(configuration, GCHandle.ToIntPtr(tcsHandle),
+                    progressHandle.HasValue ? GCHandle.ToIntPtr(progressHandle.Value) : IntPtr.Zero);
+
+                async Task<SharedRealmHandle> WaitForOpenTask()
                 {
-                    // make another copy so we can open a temporary realm on this worker thread
-                    // to execute any migrations on the background
-                    // without clobbering the original config's managed handle
-                    var configCopy = config;
-                    configCopy.managed_config = GCHandle.ToIntPtr(GCHandle.Alloc(this));
-                    using (CreateHandle(configCopy))
+                    try
                     {
+                        // Disposing the registration waits for a cancellation that is in progress, so the handle can't
+                        // be cancelled after it was disposed below.
+                        ThreadSafeReferenceHandle realmReference;
+                        using (cancellationToken.Register(() =>
+                        {
+                            handle.Cancel();
+                            tcs.TrySetCanceled();
+                        }))
+                        {
+                            realmReference = await tcs.Task;
+                        }
+
+                        using (realmReference)
+                        {
+                            return SharedRealmHandle.ResolveFromReference(realmReference);
+                        }
                     }
-                }, cancellationToken).ContinueWith(_ => CreateHandle(config), scheduler);
+                    finally
+                    {
+                        // Once Cancel returns or the open has completed, native code no longer uses the handles.
+                        tcsHandle.Free();
+                        progressHandle?.Free();
+                        handle.Dispose();
+                    }
+                }
+
+                return WaitForOpenTask();
             }
 
             return Task.FromResult(CreateHandle(configuration));
@@ -206,6 +206,37 @@ public static string GetPathToRealm(string? optionalPath = null)
         /// <seealso cref="Realm.Freeze"/>
         public ulong MaxNumberOfActiveVersions { get; set; } = ulong.MaxValue;
 
+        /// <summary>
+        /// Gets or sets the size in bytes that an existing Realm file is extended to when it's opened, if it's smaller.
+        /// </summary>
+        /// <remarks>
+        /// Preallocating the file lets large Realms that keep growing be memory-mapped in one go, rather than remapped
+        /// each time they grow. The extra space is used for new data and is reclaimed by <see cref="Realm.Compact"/>.
+        /// New, in-memory, read-only and encrypted Realms are not preallocated. Synchronized Realms ignore this setting.
+        /// </remarks>
+        /// <value>The size to preallocate the file to, or 0 to let the file grow as needed.</value>
+        public ulong PreallocateFileSize { get; set; }
+
+        /// <summary>
+        /// Gets or sets the duration after which query evaluations are considered slow. Slow queries are logged
+        /// with <see cref="Logging.LogLevel.Warn"/> together with their description.
+        /// </summary>
+        /// <value>The slow query threshold or <c>null</c> if slow queries should not be logged.</value>
+        public TimeSpan? SlowQueryThreshold { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value indicating whether consecutive asynchronous commits may be grouped together and written to disk
+        /// with a single flush.
+        /// </summary>
+        /// <remarks>
+        /// Grouping commits considerably increases the throughput of many small asynchronous writes, such as the ones performed
+        /// by <see cref="Realm.WriteAsync(Action, CancellationToken)"/>, as each of them no longer has to wait for its own flush.
+        /// The <see cref="Task"/> returned by <see cref="Transaction.CommitAsync(CancellationToken)"/> still only completes once
+        /// the group containing the commit has been written to disk. Synchronous commits are never grouped.
+        /// </remarks>
+        /// <value><c>true</c> if asynchronous commits can be grouped; <c>false</c> otherwise. Defaults to <c>false</c>.</value>
+        public bool GroupAsyncCommits { get; set; }
+
         internal InitialDataDelegate? PopulateInitialData { get; set; }
 
         internal RealmConfigurationBase(string? optionalPath)
@@ -247,6 +278,7 @@ internal virtual Configuration CreateNativeConfiguration(Arena arena)
                 schema_version = SchemaVersion,
                 enable_cache = EnableCache,
                 max_number_of_active_versions = MaxNumberOfActiveVersions,
+                preallocate_size = PreallocateFileSize,
 #pragma warning disable CS0618 // Type or member is obsolete
                 use_legacy_guid_representation = Realm.UseLegacyGuidRepresentation,
 #pragma warning restore CS0618 // Type or member is obsolete
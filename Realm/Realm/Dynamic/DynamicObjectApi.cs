@@ -167,6 +167,42 @@ public IQueryable<IRealmObjectBase> GetBacklinksFromType(string fromObjectType,
             return new RealmResults<IRealmObject>(_managedAccessor.Realm, resultsHandle, relatedMeta);
         }
 
+        /// <summary>
+        /// Gets the number of objects pointing to this one via a backlink property. This property must have been declared
+        /// explicitly and annotated with <see cref="BacklinkAttribute"/>.
+        /// </summary>
+        /// <remarks>
+        /// Unlike calling <c>Count()</c> on the result of <see cref="GetBacklinks"/>, this doesn't collect the linking objects,
+        /// so it takes constant time regardless of how many there are.
+        /// </remarks>
+        /// <param name="propertyName">The name of the backlink property.</param>
+        /// <returns>The number of objects pointing to this one via the property specified in <see cref="BacklinkAttribute.Property"/>.</returns>
+        public int GetBacklinkCount(string propertyName)
+        {
+            GetProperty(propertyName, PropertyTypeEx.IsComputed);
+
+            return _managedAccessor.ObjectHandle.GetBacklinkCount(propertyName, _managedAccessor.Metadata);
+        }
+
+        /// <summary>
+        /// Gets the number of objects that link to this object in the specified relationship.
+        /// </summary>
+        /// <remarks>
+        /// Unlike calling <c>Count()</c> on the result of <see cref="GetBacklinksFromType"/>, this doesn't collect the linking
+        /// objects, so it takes constant time regardless of how many there are.
+        /// </remarks>
+        /// <param name="fromObjectType">The type of the object that is on the other end of the relationship.</param>
+        /// <param name="fromPropertyName">The property that is on the other end of the relationship.</param>
+        /// <returns>
+        /// The number of objects of <paramref name="fromObjectType"/> that link to the current object via <paramref name="fromPropertyName"/>.
+        /// </returns>
+        public int GetBacklinkCountFromType(string fromObjectType, string fromPropertyName)
+        {
+            Argument.Ensure(_managedAccessor.Realm.Metadata.TryGetValue(fromObjectType, out var relatedMeta), $"Could not find schema for type {fromObjectType}", nameof(fromObjectType));
+
+            return _managedAccessor.ObjectHandle.GetBacklinkCountForType(relatedMeta.TableKey, fromPropertyName, relatedMeta);
+        }
+
         /// <summary>
         /// Gets a <see cref="IList{T}"/> property.
         /// </summary>
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+using System.Threading.Tasks;
+using Realms.Native;
+
+namespace Realms
+{
+    /// <summary>
+    /// A query evaluated on the native worker pool against a frozen Realm. The outcome can be read once the task
+    /// returned by <see cref="RunAsync"/> has completed.
+    /// </summary>
+    internal class BackgroundQueryHandle : StandaloneHandle
+    {
+        public delegate IntPtr Starter(IntPtr taskCompletionSource, out NativeException ex);
+
+        private static class NativeMethods
+        {
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "background_query_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr query);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "background_query_get_value", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void get_value(BackgroundQueryHandle query, out PrimitiveValue value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "background_query_get_results", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_results(BackgroundQueryHandle query, out NativeException ex);
+        }
+
+        private BackgroundQueryHandle(IntPtr handle) : base(handle)
+        {
+        }
+
+        public static async Task<BackgroundQueryHandle> RunAsync(Starter start)
+        {
+            // The pool thread completes the task, so continuations must not run inline on it.
+            var tcs = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+            var tcsHandle = GCHandle.Alloc(tcs);
+            BackgroundQueryHandle? handle = null;
+            try
+            {
+                var result = start(GCHandle.ToIntPtr(tcsHandle), out var ex);
+                ex.ThrowIfNecessary();
+                handle = new BackgroundQueryHandle(result);
+
+                await tcs.Task;
+                return handle;
+            }
+            catch
+            {
+                handle?.Dispose();
+                throw;
+            }
+            finally
+            {
+                tcsHandle.Free();
+            }
+        }
+
+        public RealmValue GetValue()
+        {
+            NativeMethods.get_value(this, out var value, out var ex);
+            ex.ThrowIfNecessary();
+            return new RealmValue(value);
+        }
+
+        public IntPtr GetResults()
+        {
+            var result = NativeMethods.get_results(this, out var ex);
+            ex.ThrowIfNecessary();
+            return result;
+        }
+
+        protected override void Unbind() => NativeMethods.destroy(handle);
+    }
+}
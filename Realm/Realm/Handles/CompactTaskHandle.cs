@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+using Realms.Native;
+
+namespace Realms
+{
+    internal class CompactTaskHandle : StandaloneHandle
+    {
+        private static class NativeMethods
+        {
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_compact_async_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr task);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_compact_async_cancel", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void cancel(CompactTaskHandle task, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_compact_async_get_result", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void get_result(CompactTaskHandle task, out CompactionResult result, out NativeException ex);
+        }
+
+        public CompactTaskHandle(IntPtr handle) : base(handle)
+        {
+        }
+
+        /// <summary>
+        /// Stops the compaction if it hasn't started yet. Once this returns, the task will not be completed.
+        /// </summary>
+        public void Cancel()
+        {
+            NativeMethods.cancel(this, out var ex);
+            ex.ThrowIfNecessary();
+        }
+
+        public CompactionResult GetResult()
+        {
+            NativeMethods.get_result(this, out var result, out var ex);
+            ex.ThrowIfNecessary();
+            return result;
+        }
+
+        protected override void Unbind() => NativeMethods.destroy(handle);
+    }
+}
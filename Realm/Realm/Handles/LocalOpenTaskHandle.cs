@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms
+{
+    internal class LocalOpenTaskHandle : StandaloneHandle
+    {
+        private static class NativeMethods
+        {
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_open_async_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr task);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_open_async_cancel", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void cancel(LocalOpenTaskHandle task, out NativeException ex);
+        }
+
+        public LocalOpenTaskHandle(IntPtr handle) : base(handle)
+        {
+        }
+
+        /// <summary>
+        /// Stops the open at the next opportunity. Once this returns, the open callback will not be invoked.
+        /// </summary>
+        public void Cancel()
+        {
+            NativeMethods.cancel(this, out var ex);
+            ex.ThrowIfNecessary();
+        }
+
+        protected override void Unbind() => NativeMethods.destroy(handle);
+    }
+}
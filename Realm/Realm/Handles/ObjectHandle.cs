@@ -28,6 +28,8 @@ namespace Realms
 {
     internal class ObjectHandle : NotifiableObjectHandleBase
     {
+        private ObjectKeys? _keys;
+
         private static class NativeMethods
         {
 #pragma warning disable IDE0049 // Naming Styles
@@ -74,8 +76,8 @@ private static class NativeMethods
             [return: MarshalAs(UnmanagedType.U1)]
             public static extern bool equals_object(ObjectHandle handle, ObjectHandle otherHandle, out NativeException ex);
 
-            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_hashcode", CallingConvention = CallingConvention.Cdecl)]
-            public static extern Int32 get_hashcode(ObjectHandle handle, out NativeException ex);
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_keys", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void get_keys(ObjectHandle handle, out TableKey tableKey, out Int64 objKey, out NativeException ex);
 
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_backlinks", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_backlinks(ObjectHandle objectHandle, IntPtr property_index, out NativeException nativeException);
@@ -92,6 +94,12 @@ private static class NativeMethods
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_backlink_count", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_backlink_count(ObjectHandle objectHandle, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_backlink_count_for_property", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_backlink_count_for_property(ObjectHandle objectHandle, IntPtr property_index, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_backlink_count_for_type", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_backlink_count_for_type(ObjectHandle objectHandle, TableKey table_key, IntPtr source_property_index, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_freeze", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr freeze(ObjectHandle handle, SharedRealmHandle frozen_realm, out NativeException ex);
 
@@ -122,26 +130,43 @@ public ObjectHandle(SharedRealmHandle root, IntPtr handle) : base(root, handle)
         {
         }
 
-        public bool ObjEquals(ObjectHandle other)
+        public ObjectKeys Keys
         {
-            EnsureIsOpen();
+            get
+            {
+                if (_keys is null)
+                {
+                    EnsureIsOpen();
 
-            var result = NativeMethods.equals_object(this, other, out var nativeException);
-            nativeException.ThrowIfNecessary();
+                    NativeMethods.get_keys(this, out var tableKey, out var objKey, out var nativeException);
+                    nativeException.ThrowIfNecessary();
 
-            return result;
+                    _keys = new ObjectKeys(tableKey, objKey);
+                }
+
+                return _keys.Value;
+            }
         }
 
-        public int GetObjHash()
+        public bool ObjEquals(ObjectHandle other)
         {
-            EnsureIsOpen();
+            // Objects with different keys are never equal, which is the common outcome when objects are used as keys
+            // in sets and dictionaries, so it doesn't need to call into native code.
+            if (Keys != other.Keys)
+            {
+                return false;
+            }
 
-            var result = NativeMethods.get_hashcode(this, out var nativeException);
+            // Equal keys still need checking natively, as a deleted object isn't equal to anything, including a new
+            // object that reuses its key.
+            var result = NativeMethods.equals_object(this, other, out var nativeException);
             nativeException.ThrowIfNecessary();
 
             return result;
         }
 
+        public int GetObjHash() => Keys.GetHashCode();
+
         public override void Unbind() => NativeMethods.destroy(handle);
 
         public RealmValue GetValue(string propertyName, Metadata metadata, Realm realm)
@@ -374,6 +399,26 @@ public int GetBacklinkCount()
             return (int)result;
         }
 
+        public int GetBacklinkCount(string propertyName, Metadata metadata)
+        {
+            EnsureIsOpen();
+
+            var propertyIndex = metadata.GetPropertyIndex(propertyName);
+            var result = NativeMethods.get_backlink_count_for_property(this, propertyIndex, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return (int)result;
+        }
+
+        public int GetBacklinkCountForType(TableKey tableKey, string propertyName, Metadata metadata)
+        {
+            EnsureIsOpen();
+
+            var propertyIndex = metadata.GetPropertyIndex(propertyName);
+            var result = NativeMethods.get_backlink_count_for_type(this, tableKey, propertyIndex, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return (int)result;
+        }
+
         public override ThreadSafeReferenceHandle GetThreadSafeReference()
         {
             EnsureIsOpen();
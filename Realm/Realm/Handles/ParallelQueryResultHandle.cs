@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+using Realms.Native;
+
+namespace Realms
+{
+    /// <summary>
+    /// The objects matched by a frozen <see cref="ResultsHandle"/> whose query was evaluated on several threads, in the
+    /// order they are stored in the table.
+    /// </summary>
+    internal class ParallelQueryResultHandle : RealmHandle
+    {
+        private static class NativeMethods
+        {
+#pragma warning disable IDE1006 // Naming Styles
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "parallel_query_result_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr resultHandle);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "parallel_query_result_count", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr count(ParallelQueryResultHandle result, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "parallel_query_result_get_objects", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_objects(ParallelQueryResultHandle result, IntPtr start, [Out] PrimitiveValue[] buffer, IntPtr buffer_size, out NativeException ex);
+
+#pragma warning restore IDE1006 // Naming Styles
+        }
+
+        [Preserve]
+        public ParallelQueryResultHandle(SharedRealmHandle root, IntPtr handle) : base(root, handle)
+        {
+        }
+
+        public int Count()
+        {
+            EnsureIsOpen();
+
+            var result = NativeMethods.count(this, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            return (int)result;
+        }
+
+        public RealmValue[] GetObjects(int start, int count, Realm realm)
+        {
+            EnsureIsOpen();
+
+            var buffer = new PrimitiveValue[count];
+            var actualCount = (int)NativeMethods.get_objects(this, (IntPtr)start, buffer, (IntPtr)count, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            var result = new RealmValue[actualCount];
+            for (var i = 0; i < actualCount; i++)
+            {
+                result[i] = new RealmValue(buffer[i], realm);
+            }
+
+            return result;
+        }
+
+        public override void Unbind() => NativeMethods.destroy(handle);
+    }
+}
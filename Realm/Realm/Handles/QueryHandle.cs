@@ -18,6 +18,7 @@
 
 using System;
 using System.Runtime.InteropServices;
+using System.Threading.Tasks;
 using Realms.Native;
 
 namespace Realms
@@ -110,6 +111,10 @@ private static class NativeMethods
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_create_results", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr create_results(QueryHandle queryPtr, SharedRealmHandle sharedRealm, SortDescriptorHandle sortDescriptor, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_create_results_async", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr create_results_async(QueryHandle queryPtr, SharedRealmHandle sharedRealm, SortDescriptorHandle sortDescriptor,
+                SharedRealmHandle frozen_realm, IntPtr tcs_handle, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_realm_value_type_equal", CallingConvention = CallingConvention.Cdecl)]
             public static extern void realm_value_type_equal(QueryHandle queryPtr, SharedRealmHandle realm, IntPtr property_ndx, RealmValueType realm_value_type, out NativeException ex);
 
@@ -388,6 +393,28 @@ public ResultsHandle CreateResults(SharedRealmHandle sharedRealm, SortDescriptor
             return new ResultsHandle(sharedRealm, result);
         }
 
+        /// <summary>
+        /// Like <see cref="CreateResults"/>, but the results are evaluated against a frozen copy of the Realm on the native
+        /// worker pool and belong to that frozen Realm.
+        /// </summary>
+        public async Task<ResultsHandle> CreateResultsAsync(SharedRealmHandle sharedRealm, SortDescriptorHandle sortDescriptor)
+        {
+            EnsureIsOpen();
+
+            var frozenRealm = sharedRealm.Freeze();
+            try
+            {
+                using var query = await BackgroundQueryHandle.RunAsync((IntPtr tcs, out NativeException ex) =>
+                    NativeMethods.create_results_async(this, sharedRealm, sortDescriptor, frozenRealm, tcs, out ex));
+                return new ResultsHandle(frozenRealm, query.GetResults());
+            }
+            catch
+            {
+                frozenRealm.Dispose();
+                throw;
+            }
+        }
+
         public static void Validate(GeoShapeBase geoShape)
         {
             var (queryArg, handles) = geoShape.ToNative();
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+using Realms.Native;
+
+namespace Realms
+{
+    /// <summary>
+    /// A keyset cursor over the objects in a <see cref="ResultsHandle"/>. Each page resumes after the last object
+    /// returned by the previous one rather than at a fixed offset, so the cost of fetching a page doesn't grow with the
+    /// number of pages already read and writes between pages don't cause objects to be skipped or repeated.
+    /// </summary>
+    internal class ResultsCursorHandle : RealmHandle
+    {
+        private static class NativeMethods
+        {
+#pragma warning disable IDE1006 // Naming Styles
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_cursor_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr cursorHandle);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_cursor_next_page", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr next_page(ResultsCursorHandle cursor, [Out] PrimitiveValue[] buffer, IntPtr buffer_size, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_cursor_reset", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void reset(ResultsCursorHandle cursor, out NativeException ex);
+
+#pragma warning restore IDE1006 // Naming Styles
+        }
+
+        [Preserve]
+        public ResultsCursorHandle(SharedRealmHandle root, IntPtr handle) : base(root, handle)
+        {
+        }
+
+        public RealmValue[] NextPage(int pageSize, Realm realm)
+        {
+            EnsureIsOpen();
+
+            var buffer = new PrimitiveValue[pageSize];
+            var count = (int)NativeMethods.next_page(this, buffer, (IntPtr)pageSize, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            var result = new RealmValue[count];
+            for (var i = 0; i < count; i++)
+            {
+                result[i] = new RealmValue(buffer[i], realm);
+            }
+
+            return result;
+        }
+
+        public void Reset()
+        {
+            EnsureIsOpen();
+
+            NativeMethods.reset(this, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public override void Unbind() => NativeMethods.destroy(handle);
+    }
+}
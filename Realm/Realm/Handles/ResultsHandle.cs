@@ -21,6 +21,7 @@
 using System.Collections.Generic;
 using System.Linq;
 using System.Runtime.InteropServices;
+using System.Threading.Tasks;
 using Realms.Helpers;
 using Realms.Native;
 
@@ -76,6 +77,28 @@ private static class NativeMethods
 
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_description", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_description(ResultsHandle resultsHandle, IntPtr buffer, IntPtr bufferLength, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_create_cursor", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr create_cursor(ResultsHandle results, [MarshalAs(UnmanagedType.LPArray), In] CursorSortClause[] sort_clauses, IntPtr sort_clauses_count, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_count_async", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr count_async(ResultsHandle results, SharedRealmHandle frozen_realm, IntPtr tcs_handle, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_snapshot_async", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr snapshot_async(ResultsHandle results, SharedRealmHandle frozen_realm, IntPtr tcs_handle, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_aggregate_async", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr aggregate_async(ResultsHandle results, SharedRealmHandle frozen_realm, IntPtr property_index, AggregateType type, IntPtr tcs_handle, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_evaluate_parallel", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr evaluate_parallel(ResultsHandle results, IntPtr max_threads, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_export", CallingConvention = CallingConvention.Cdecl)]
+            public static extern ulong export(ResultsHandle results, [MarshalAs(UnmanagedType.LPArray), In] IntPtr[] property_indices, IntPtr properties_count,
+                [MarshalAs(UnmanagedType.LPWStr)] string path, IntPtr path_len, ExportFormat format, IntPtr batch_size, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_explain", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void explain(ResultsHandle results, out QueryExplanation explanation, out NativeException ex);
         }
 
         public override bool IsValid
@@ -160,6 +183,101 @@ public SortDescriptorHandle GetSortDescriptor()
             return new SortDescriptorHandle(Root!, result);
         }
 
+        public ResultsCursorHandle CreateCursor(CursorSortClause[] sortClauses)
+        {
+            EnsureIsOpen();
+
+            var result = NativeMethods.create_cursor(this, sortClauses, (IntPtr)sortClauses.Length, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            return new ResultsCursorHandle(Root!, result);
+        }
+
+        /// <summary>
+        /// Counts the results against a frozen copy of the Realm on the native worker pool.
+        /// </summary>
+        public async Task<int> CountAsync()
+        {
+            EnsureIsOpen();
+
+            using var frozenRealm = Root!.Freeze();
+            using var query = await BackgroundQueryHandle.RunAsync((IntPtr tcs, out NativeException ex) => NativeMethods.count_async(this, frozenRealm, tcs, out ex));
+            return (int)query.GetValue().AsInt64();
+        }
+
+        /// <summary>
+        /// Evaluates the results against a frozen copy of the Realm on the native worker pool. The returned results belong to
+        /// that frozen Realm.
+        /// </summary>
+        public async Task<ResultsHandle> SnapshotAsync()
+        {
+            EnsureIsOpen();
+
+            var frozenRealm = Root!.Freeze();
+            try
+            {
+                using var query = await BackgroundQueryHandle.RunAsync((IntPtr tcs, out NativeException ex) => NativeMethods.snapshot_async(this, frozenRealm, tcs, out ex));
+                return new ResultsHandle(frozenRealm, query.GetResults());
+            }
+            catch
+            {
+                frozenRealm.Dispose();
+                throw;
+            }
+        }
+
+        /// <summary>
+        /// Computes an aggregate of a property against a frozen copy of the Realm on the native worker pool. The value is
+        /// null if there is nothing to aggregate.
+        /// </summary>
+        public async Task<RealmValue> AggregateAsync(IntPtr propertyIndex, AggregateType type)
+        {
+            EnsureIsOpen();
+
+            using var frozenRealm = Root!.Freeze();
+            using var query = await BackgroundQueryHandle.RunAsync((IntPtr tcs, out NativeException ex) => NativeMethods.aggregate_async(this, frozenRealm, propertyIndex, type, tcs, out ex));
+            return query.GetValue();
+        }
+
+        /// <summary>
+        /// Evaluates the query of these frozen results on up to <paramref name="maxThreads"/> threads. Sorting, distinct and
+        /// limits aren't supported.
+        /// </summary>
+        public ParallelQueryResultHandle EvaluateParallel(int maxThreads)
+        {
+            EnsureIsOpen();
+
+            var result = NativeMethods.evaluate_parallel(this, (IntPtr)maxThreads, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            return new ParallelQueryResultHandle(Root!, result);
+        }
+
+        /// <summary>
+        /// Writes the objects in the results to <paramref name="path"/>, reading them from a frozen snapshot.
+        /// If <paramref name="propertyIndices"/> is empty, all properties that aren't links or collections are exported.
+        /// </summary>
+        /// <returns>The number of exported objects.</returns>
+        public ulong Export(string path, IntPtr[] propertyIndices, ExportFormat format, int batchSize)
+        {
+            EnsureIsOpen();
+
+            var result = NativeMethods.export(this, propertyIndices, (IntPtr)propertyIndices.Length, path, (IntPtr)path.Length, format, (IntPtr)batchSize, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            return result;
+        }
+
+        public QueryExplanation Explain()
+        {
+            EnsureIsOpen();
+
+            NativeMethods.explain(this, out var explanation, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            return explanation;
+        }
+
         public override NotificationTokenHandle AddNotificationCallback(IntPtr managedObjectHandle,
             KeyPathsCollection keyPathsCollection, IntPtr callback)
         {
@@ -21,9 +21,11 @@
 using System.Diagnostics.CodeAnalysis;
 using System.Linq;
 using System.Runtime.InteropServices;
+using System.Text;
 using System.Threading;
 using System.Threading.Tasks;
 using Realms.Exceptions;
+using Realms.Helpers;
 using Realms.Logging;
 using Realms.Native;
 using Realms.Schema;
@@ -92,9 +94,22 @@ public struct CategoryNamesContainer
             [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
             internal delegate IntPtr InitializationCallback(IntPtr managedInitializationDelegate, IntPtr realm);
 
+            [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.U1)]
+            internal delegate bool OperationProgressCallback(IntPtr managedProgress, ulong processedUnits, ulong processedBytes, ulong totalBytes, double elapsedSeconds);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_open", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr open(Configuration configuration, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_open_async", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr open_async(Configuration configuration, IntPtr task_completion_source, IntPtr managed_progress, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_compact_async", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr compact_async(Configuration configuration, IntPtr task_completion_source, IntPtr managed_progress, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_last_open_timings", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void get_last_open_timings(out OpenRealmTimings timings);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_open_with_sync", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr open_with_sync(Configuration configuration, Sync.Native.SyncConfiguration sync_configuration,
                 out NativeException ex);
@@ -126,7 +141,7 @@ public struct CategoryNamesContainer
             public static extern UInt32 begin_transaction_async(SharedRealmHandle sharedRealm, IntPtr tcsPtr, out NativeException ex);
 
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_commit_transaction_async", CallingConvention = CallingConvention.Cdecl)]
-            public static extern UInt32 commit_transaction_async(SharedRealmHandle sharedRealm, IntPtr tcsPtr, out NativeException ex);
+            public static extern UInt32 commit_transaction_async(SharedRealmHandle sharedRealm, IntPtr tcsPtr, [MarshalAs(UnmanagedType.U1)] bool allow_grouping, out NativeException ex);
 
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_cancel_async_transaction", CallingConvention = CallingConvention.Cdecl)]
             public static extern bool cancel_async_transaction(SharedRealmHandle sharedRealm, UInt32 transaction_handle, out NativeException ex);
@@ -194,7 +209,8 @@ public struct CategoryNamesContainer
                 MigrationCallback migration_callback,
                 ShouldCompactCallback should_compact_callback,
                 HandleTaskCompletionCallback handle_task_completion,
-                InitializationCallback initialization_callback);
+                InitializationCallback initialization_callback,
+                OperationProgressCallback operation_progress_callback);
 
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_is_frozen", CallingConvention = CallingConvention.Cdecl)]
             [return: MarshalAs(UnmanagedType.U1)]
@@ -203,9 +219,37 @@ public struct CategoryNamesContainer
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_freeze", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr freeze(SharedRealmHandle sharedRealm, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_freeze_many", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void freeze_many(SharedRealmHandle frozenRealm, IntPtr[] values, ThreadSafeReference.Type[] types, IntPtr count, [Out] IntPtr[] results, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_object_for_primary_key", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_object_for_primary_key(SharedRealmHandle realmHandle, UInt32 table_key, PrimitiveValue value, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_objects_for_primary_keys", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void get_objects_for_primary_keys(SharedRealmHandle realmHandle, UInt32 table_key,
+                [MarshalAs(UnmanagedType.LPArray), In] PrimitiveValue[] values, IntPtr values_count,
+                [MarshalAs(UnmanagedType.LPArray), Out] IntPtr[] objects, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_upsert_objects", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void upsert_objects(SharedRealmHandle realmHandle, UInt32 table_key,
+                [MarshalAs(UnmanagedType.LPArray), In] PrimitiveValue[] primary_keys, IntPtr count,
+                [MarshalAs(UnmanagedType.LPArray), In] IntPtr[] property_indices, IntPtr properties_count,
+                [MarshalAs(UnmanagedType.LPArray), In] PrimitiveValue[] values, [MarshalAs(UnmanagedType.U1)] bool columnar,
+                [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.U1), Out] bool[] is_new, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_bulk_create", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void bulk_create(SharedRealmHandle realmHandle, UInt32 table_key, IntPtr count,
+                [MarshalAs(UnmanagedType.LPArray), In] BulkColumn[] columns, IntPtr columns_count, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_prewarm", CallingConvention = CallingConvention.Cdecl)]
+            public static extern UInt64 prewarm(SharedRealmHandle realmHandle, [MarshalAs(UnmanagedType.LPArray), In] UInt32[] table_keys, IntPtr table_keys_count,
+                UInt64 budget_bytes, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_import_file", CallingConvention = CallingConvention.Cdecl)]
+            public static extern UInt64 import_file(SharedRealmHandle realmHandle, UInt32 table_key,
+                [MarshalAs(UnmanagedType.LPWStr)] string path, IntPtr path_len, ImportFormat format,
+                IntPtr chunk_size, IntPtr memory_budget, IntPtr managed_progress, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_create_results", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr create_results(SharedRealmHandle sharedRealm, UInt32 table_key, out NativeException ex);
 
@@ -235,6 +279,13 @@ public struct CategoryNamesContainer
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_refresh_async", CallingConvention = CallingConvention.Cdecl)]
             public static extern bool refresh_async(SharedRealmHandle realm, IntPtr tcs_handle, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_transaction_version", CallingConvention = CallingConvention.Cdecl)]
+            public static extern UInt64 get_transaction_version(SharedRealmHandle realm, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_wait_for_version_async", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.U1)]
+            public static extern bool wait_for_version_async(SharedRealmHandle realm, UInt64 version, IntPtr tcs_handle, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_log_level", CallingConvention = CallingConvention.Cdecl)]
             public static extern LogLevel get_log_level([MarshalAs(UnmanagedType.LPWStr)] string category_name, IntPtr category_name_len);
 
@@ -244,6 +295,16 @@ public struct CategoryNamesContainer
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_log_category_names", CallingConvention = CallingConvention.Cdecl)]
             public static extern CategoryNamesContainer get_log_category_names();
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_set_slow_query_threshold", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_slow_query_threshold(SharedRealmHandle sharedRealm, UInt64 threshold_us, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_set_metrics_enabled", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_metrics_enabled(SharedRealmHandle sharedRealm, [MarshalAs(UnmanagedType.U1)] bool enabled, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_metrics", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.U1)]
+            public static extern bool get_metrics(SharedRealmHandle sharedRealm, out TransactionMetrics metrics, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_operating_system", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_operating_system(IntPtr buffer, IntPtr buffer_length);
 
@@ -272,6 +333,7 @@ public static unsafe void Initialize()
             NativeMethods.ShouldCompactCallback shouldCompact = ShouldCompactOnLaunchCallback;
             NativeMethods.HandleTaskCompletionCallback handleTaskCompletion = OnTaskCompleted;
             NativeMethods.InitializationCallback onInitialization = OnDataInitialization;
+            NativeMethods.OperationProgressCallback onOperationProgress = OnOperationProgress;
 
             GCHandle.Alloc(notifyRealm);
             GCHandle.Alloc(getNativeSchema);
@@ -284,9 +346,10 @@ public static unsafe void Initialize()
             GCHandle.Alloc(shouldCompact);
             GCHandle.Alloc(handleTaskCompletion);
             GCHandle.Alloc(onInitialization);
+            GCHandle.Alloc(onOperationProgress);
 
             NativeMethods.install_callbacks(notifyRealm, getNativeSchema, openRealm, disposeGCHandle, logMessage,
-                notifyObject, notifyDictionary, onMigration, shouldCompact, handleTaskCompletion, onInitialization);
+                notifyObject, notifyDictionary, onMigration, shouldCompact, handleTaskCompletion, onInitialization, onOperationProgress);
         }
 
         public static LogLevel GetLogLevel(LogCategory category) => NativeMethods.get_log_level(category.Name, (IntPtr)category.Name.Length);
@@ -423,6 +486,22 @@ public static SharedRealmHandle Open(Configuration configuration)
             return new SharedRealmHandle(result);
         }
 
+        public static LocalOpenTaskHandle OpenAsync(Configuration configuration, IntPtr taskCompletionSource, IntPtr managedProgress)
+        {
+            var result = NativeMethods.open_async(configuration, taskCompletionSource, managedProgress, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return new LocalOpenTaskHandle(result);
+        }
+
+        /// <summary>
+        /// Gets the phase breakdown of the last <see cref="Open"/> call on the current thread.
+        /// </summary>
+        public static OpenRealmTimings GetLastOpenTimings()
+        {
+            NativeMethods.get_last_open_timings(out var timings);
+            return timings;
+        }
+
         public static SharedRealmHandle OpenWithSync(Configuration configuration, Sync.Native.SyncConfiguration syncConfiguration)
         {
             var result = NativeMethods.open_with_sync(configuration, syncConfiguration, out var nativeException);
@@ -482,6 +561,29 @@ public void SetManagedStateHandle(Realm.State managedState)
             nativeException.ThrowIfNecessary();
         }
 
+        public void SetSlowQueryThreshold(TimeSpan threshold)
+        {
+            // The native threshold is in microseconds and 0 disables logging, so shorter thresholds are rounded up
+            // to 1 µs rather than truncated to 0.
+            var microseconds = Math.Max(1L, (long)Math.Ceiling(threshold.Ticks / (TimeSpan.TicksPerMillisecond / 1000.0)));
+            NativeMethods.set_slow_query_threshold(this, (ulong)microseconds, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void SetMetricsEnabled(bool enabled)
+        {
+            NativeMethods.set_metrics_enabled(this, enabled, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public TransactionMetrics? GetMetrics()
+        {
+            var hasMetrics = NativeMethods.get_metrics(this, out var metrics, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            return hasMetrics ? metrics : null;
+        }
+
         public IntPtr GetManagedStateHandle()
         {
             var result = NativeMethods.get_managed_state_handle(this, out var nativeException);
@@ -529,7 +631,7 @@ public void CommitTransaction()
             nativeException.ThrowIfNecessary();
         }
 
-        public async Task CommitTransactionAsync(SynchronizationContext synchronizationContext, CancellationToken ct)
+        public async Task CommitTransactionAsync(SynchronizationContext synchronizationContext, bool allowGrouping, CancellationToken ct)
         {
             var tcs = new TaskCompletionSource();
             var tcsHandle = GCHandle.Alloc(tcs);
@@ -537,7 +639,7 @@ public async Task CommitTransactionAsync(SynchronizationContext synchronizationC
             ct.Register(() => CancelAsyncTransaction(asyncTransactionHandle, tcs, synchronizationContext));
             try
             {
-                asyncTransactionHandle = NativeMethods.commit_transaction_async(this, GCHandle.ToIntPtr(tcsHandle), out var nativeException);
+                asyncTransactionHandle = NativeMethods.commit_transaction_async(this, GCHandle.ToIntPtr(tcsHandle), allowGrouping, out var nativeException);
                 nativeException.ThrowIfNecessary();
 
                 // When starting an async operation, core internally queues a cb and returns a handle to it (CBH).
@@ -605,6 +707,45 @@ public bool Compact()
             return result;
         }
 
+        /// <summary>
+        /// Compacts the Realm described by <paramref name="configuration"/> on a native background thread. The Realm must not be open
+        /// anywhere else. Progress is reported in bytes of the file before and after compacting, and returning <c>false</c> from
+        /// <paramref name="onProgress"/> before compaction starts aborts it.
+        /// </summary>
+        public static async Task<CompactionResult> CompactAsync(Configuration configuration, Func<OperationProgress, bool>? onProgress, CancellationToken cancellationToken)
+        {
+            // The compaction thread completes the task, so continuations must not run inline on it.
+            var tcs = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+            var tcsHandle = GCHandle.Alloc(tcs);
+            var progressHandle = onProgress == null ? (GCHandle?)null : GCHandle.Alloc(onProgress);
+            CompactTaskHandle? handle = null;
+            try
+            {
+                var result = NativeMethods.compact_async(configuration, GCHandle.ToIntPtr(tcsHandle),
+                    progressHandle.HasValue ? GCHandle.ToIntPtr(progressHandle.Value) : IntPtr.Zero, out var ex);
+                ex.ThrowIfNecessary();
+                handle = new CompactTaskHandle(result);
+
+                using (cancellationToken.Register(() =>
+                {
+                    handle.Cancel();
+                    tcs.TrySetCanceled();
+                }))
+                {
+                    await tcs.Task;
+                }
+
+                return handle.GetResult();
+            }
+            finally
+            {
+                // Once Cancel returns or the task has completed, native code no longer uses the handles.
+                tcsHandle.Free();
+                progressHandle?.Free();
+                handle?.Dispose();
+            }
+        }
+
         public IntPtr ResolveReference(ThreadSafeReference reference)
         {
             if (reference.Handle.IsClosed)
@@ -690,6 +831,35 @@ public SharedRealmHandle Freeze()
             return new SharedRealmHandle(result);
         }
 
+        /// <summary>
+        /// Freezes the live values behind <paramref name="handles"/> against this frozen Realm in a single call.
+        /// </summary>
+        /// <param name="handles">The handles of the objects and collections to freeze.</param>
+        /// <param name="types">The type of the value behind each handle.</param>
+        /// <returns>
+        /// The native pointers of the frozen values, in the order of <paramref name="handles"/>. They must be wrapped in
+        /// the handle type matching their value, rooted in this Realm.
+        /// </returns>
+        public IntPtr[] FreezeMany(IReadOnlyList<RealmHandle> handles, ThreadSafeReference.Type[] types)
+        {
+            if (handles.Count != types.Length)
+            {
+                throw new ArgumentException("Every handle must have a matching type.", nameof(types));
+            }
+
+            var values = new IntPtr[handles.Count];
+            for (var i = 0; i < values.Length; i++)
+            {
+                values[i] = handles[i].DangerousGetHandle();
+            }
+
+            var results = new IntPtr[values.Length];
+            NativeMethods.freeze_many(this, values, types, (IntPtr)values.Length, results, out var nativeException);
+            GC.KeepAlive(handles);
+            nativeException.ThrowIfNecessary();
+            return results;
+        }
+
         public bool TryFindObject(TableKey tableKey, in RealmValue id, [MaybeNullWhen(false)] out ObjectHandle objectHandle)
         {
             var (primitiveValue, handles) = id.ToNative();
@@ -707,6 +877,235 @@ public bool TryFindObject(TableKey tableKey, in RealmValue id, [MaybeNullWhen(fa
             return true;
         }
 
+        public ObjectHandle?[] FindObjects(TableKey tableKey, RealmValue[] ids)
+        {
+            var primitiveValues = new PrimitiveValue[ids.Length];
+            var handles = new RealmValue.HandlesToCleanup?[ids.Length];
+            for (var i = 0; i < ids.Length; i++)
+            {
+                (primitiveValues[i], handles[i]) = ids[i].ToNative();
+            }
+
+            var results = new IntPtr[ids.Length];
+            NativeMethods.get_objects_for_primary_keys(this, tableKey.Value, primitiveValues, (IntPtr)ids.Length, results, out var ex);
+
+            foreach (var handle in handles)
+            {
+                handle?.Dispose();
+            }
+
+            ex.ThrowIfNecessary();
+
+            var objectHandles = new ObjectHandle?[ids.Length];
+            for (var i = 0; i < results.Length; i++)
+            {
+                if (results[i] != IntPtr.Zero)
+                {
+                    objectHandles[i] = new ObjectHandle(this, results[i]);
+                }
+            }
+
+            return objectHandles;
+        }
+
+        /// <summary>
+        /// Creates or updates the objects with the given primary keys and sets <paramref name="propertyIndices"/> on them.
+        /// <paramref name="values"/> is laid out row by row, unless <paramref name="columnar"/> is <c>true</c>, in which
+        /// case it contains all values for the first property, followed by all values for the second one and so on.
+        /// </summary>
+        /// <returns>An array indicating for each primary key whether a new object was created.</returns>
+        public bool[] UpsertObjects(TableKey tableKey, RealmValue[] primaryKeys, IntPtr[] propertyIndices, RealmValue[] values, bool columnar)
+        {
+            Argument.Ensure(values.Length == primaryKeys.Length * propertyIndices.Length, "There should be exactly one value for each primary key and property.", nameof(values));
+
+            var handles = new List<RealmValue.HandlesToCleanup?>();
+            PrimitiveValue[] ToNative(RealmValue[] realmValues)
+            {
+                var result = new PrimitiveValue[realmValues.Length];
+                for (var i = 0; i < realmValues.Length; i++)
+                {
+                    (result[i], var handle) = realmValues[i].ToNative();
+                    handles.Add(handle);
+                }
+
+                return result;
+            }
+
+            var isNew = new bool[primaryKeys.Length];
+            NativeMethods.upsert_objects(this, tableKey.Value, ToNative(primaryKeys), (IntPtr)primaryKeys.Length,
+                propertyIndices, (IntPtr)propertyIndices.Length, ToNative(values), columnar, isNew, out var ex);
+
+            foreach (var handle in handles)
+            {
+                handle?.Dispose();
+            }
+
+            ex.ThrowIfNecessary();
+            return isNew;
+        }
+
+        /// <summary>
+        /// Creates <paramref name="count"/> objects, populating the given properties from the matching element of their values array.
+        /// Supported arrays are <c>long[]</c>, <c>long?[]</c>, <c>double[]</c>, <c>double?[]</c> and <c>string?[]</c>.
+        /// </summary>
+        public void BulkCreate(TableKey tableKey, int count, IReadOnlyList<(IntPtr PropertyIndex, Array Values)> columns)
+        {
+            var pinned = new List<GCHandle>();
+            IntPtr Pin(Array array)
+            {
+                var handle = GCHandle.Alloc(array, GCHandleType.Pinned);
+                pinned.Add(handle);
+                return handle.AddrOfPinnedObject();
+            }
+
+            // Copies the values to a preallocated array, and their nulls to a bitmap, in a single pass.
+            (IntPtr Data, IntPtr NullBitmap) PinNullable<T>(T?[] values)
+                where T : struct
+            {
+                var data = new T[values.Length];
+                var bitmap = new byte[(values.Length + 7) / 8];
+                for (var i = 0; i < values.Length; i++)
+                {
+                    if (values[i] is T value)
+                    {
+                        data[i] = value;
+                    }
+                    else
+                    {
+                        bitmap[i / 8] |= (byte)(1 << (i % 8));
+                    }
+                }
+
+                return (Pin(data), Pin(bitmap));
+            }
+
+            try
+            {
+                var nativeColumns = new BulkColumn[columns.Count];
+                for (var i = 0; i < columns.Count; i++)
+                {
+                    var (propertyIndex, values) = columns[i];
+                    Argument.Ensure(values.Length == count, $"Expected {count} values for each property, but got {values.Length}.", nameof(columns));
+
+                    nativeColumns[i].property_index = propertyIndex;
+                    switch (values)
+                    {
+                        case long[] longs:
+                            nativeColumns[i].type = RealmValueType.Int;
+                            nativeColumns[i].data = Pin(longs);
+                            break;
+                        case long?[] nullableLongs:
+                            nativeColumns[i].type = RealmValueType.Int;
+                            (nativeColumns[i].data, nativeColumns[i].null_bitmap) = PinNullable(nullableLongs);
+                            break;
+                        case double[] doubles:
+                            nativeColumns[i].type = RealmValueType.Double;
+                            nativeColumns[i].data = Pin(doubles);
+                            break;
+                        case double?[] nullableDoubles:
+                            nativeColumns[i].type = RealmValueType.Double;
+                            (nativeColumns[i].data, nativeColumns[i].null_bitmap) = PinNullable(nullableDoubles);
+                            break;
+                        case string?[] strings:
+                            // The byte counts are computed first so that the strings are encoded straight into the pinned blob.
+                            var offsets = new IntPtr[strings.Length + 1];
+                            var bitmap = new byte[(strings.Length + 7) / 8];
+                            var byteCount = 0;
+                            for (var row = 0; row < strings.Length; row++)
+                            {
+                                if (strings[row] is string value)
+                                {
+                                    byteCount += Encoding.UTF8.GetByteCount(value);
+                                }
+                                else
+                                {
+                                    bitmap[row / 8] |= (byte)(1 << (row % 8));
+                                }
+
+                                offsets[row + 1] = (IntPtr)byteCount;
+                            }
+
+                            var blob = new byte[byteCount];
+                            for (var row = 0; row < strings.Length; row++)
+                            {
+                                if (strings[row] is string value)
+                                {
+                                    Encoding.UTF8.GetBytes(value, 0, value.Length, blob, (int)offsets[row]);
+                                }
+                            }
+
+                            nativeColumns[i].type = RealmValueType.String;
+                            nativeColumns[i].data = Pin(blob);
+                            nativeColumns[i].offsets = Pin(offsets);
+                            nativeColumns[i].null_bitmap = Pin(bitmap);
+                            break;
+                        default:
+                            throw new NotSupportedException($"Arrays of type {values.GetType()} can't be used to bulk create objects.");
+                    }
+                }
+
+                NativeMethods.bulk_create(this, tableKey.Value, (IntPtr)count, nativeColumns, (IntPtr)nativeColumns.Length, out var ex);
+                ex.ThrowIfNecessary();
+            }
+            finally
+            {
+                foreach (var handle in pinned)
+                {
+                    handle.Free();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Imports the objects in the NDJSON or CSV file at <paramref name="path"/>, committing every <paramref name="chunkSize"/> objects.
+        /// <paramref name="onProgress"/> is invoked after each chunk and can stop the import by returning <c>false</c>.
+        /// </summary>
+        /// <returns>The number of imported objects.</returns>
+        public ulong ImportFile(TableKey tableKey, string path, ImportFormat format, int chunkSize, long memoryBudget, Func<OperationProgress, bool>? onProgress)
+        {
+            var progressHandle = onProgress == null ? (GCHandle?)null : GCHandle.Alloc(onProgress);
+            try
+            {
+                var result = NativeMethods.import_file(this, tableKey.Value, path, (IntPtr)path.Length, format, (IntPtr)chunkSize, (IntPtr)memoryBudget,
+                    progressHandle.HasValue ? GCHandle.ToIntPtr(progressHandle.Value) : IntPtr.Zero, out var ex);
+                ex.ThrowIfNecessary();
+                return result;
+            }
+            finally
+            {
+                progressHandle?.Free();
+            }
+        }
+
+        /// <summary>
+        /// Reads about <paramref name="budgetBytes"/> of the Realm into memory, so that the first queries after a cold start
+        /// don't stall on page faults. With no <paramref name="tableKeys"/>, the file is read into the OS page cache; otherwise
+        /// the values of the given tables are read through the Realm.
+        /// </summary>
+        /// <returns>The number of bytes read.</returns>
+        public ulong Prewarm(TableKey[] tableKeys, ulong budgetBytes)
+        {
+            var keys = tableKeys.Select(k => k.Value).ToArray();
+            var result = NativeMethods.prewarm(this, keys, (IntPtr)keys.Length, budgetBytes, out var ex);
+            ex.ThrowIfNecessary();
+            return result;
+        }
+
+        /// <summary>
+        /// Runs <see cref="Prewarm"/> on a frozen copy of this Realm on a background thread.
+        /// </summary>
+        public Task<ulong> PrewarmAsync(TableKey[] tableKeys, ulong budgetBytes)
+        {
+            var frozen = Freeze();
+            return Task.Run(() =>
+            {
+                using (frozen)
+                {
+                    return frozen.Prewarm(tableKeys, budgetBytes);
+                }
+            });
+        }
+
         public bool TryFindObject(ObjectHandle handle, [MaybeNullWhen(false)] out ObjectHandle objectHandle)
         {
             var result = NativeMethods.get_object_for_object(this, handle, out var ex);
@@ -795,6 +1194,41 @@ public async Task<bool> RefreshAsync()
             }
         }
 
+        /// <summary>
+        /// Gets the version of the transaction this Realm is reading or, right after a commit, the version it created.
+        /// </summary>
+        public ulong GetTransactionVersion()
+        {
+            var result = NativeMethods.get_transaction_version(this, out var ex);
+            ex.ThrowIfNecessary();
+            return result;
+        }
+
+        /// <summary>
+        /// Waits until this Realm has advanced to <paramref name="version"/> or a later one, for example one obtained from
+        /// <see cref="GetTransactionVersion"/> right after committing a write on another thread.
+        /// </summary>
+        public async Task WaitForVersionAsync(ulong version)
+        {
+            var tcs = new TaskCompletionSource();
+            var tcsHandle = GCHandle.Alloc(tcs);
+
+            try
+            {
+                var didRegister = NativeMethods.wait_for_version_async(this, version, GCHandle.ToIntPtr(tcsHandle), out var ex);
+                ex.ThrowIfNecessary();
+
+                if (didRegister)
+                {
+                    await tcs.Task;
+                }
+            }
+            finally
+            {
+                tcsHandle.Free();
+            }
+        }
+
         public static string GetNativeLibraryOS()
         {
             return MarshalHelpers.GetString((IntPtr buffer, IntPtr length, out bool isNull, out NativeException ex) =>
@@ -979,6 +1413,21 @@ private void CancelAsyncTransaction(uint? asyncTransactionHandle, TaskCompletion
             }, null);
         }
 
+        [MonoPInvokeCallback(typeof(NativeMethods.OperationProgressCallback))]
+        private static bool OnOperationProgress(IntPtr managedProgress, ulong processedUnits, ulong processedBytes, ulong totalBytes, double elapsedSeconds)
+        {
+            try
+            {
+                var onProgress = (Func<OperationProgress, bool>)GCHandle.FromIntPtr(managedProgress).Target!;
+                return onProgress(new OperationProgress(processedUnits, processedBytes, totalBytes, TimeSpan.FromSeconds(elapsedSeconds)));
+            }
+            catch (Exception ex)
+            {
+                RealmLogger.Default.Log(LogLevel.Error, $"An error occurred while reporting progress, the operation will be stopped: {ex}");
+                return false;
+            }
+        }
+
         [MonoPInvokeCallback(typeof(NativeMethods.InitializationCallback))]
         private static IntPtr OnDataInitialization(IntPtr managedConfigHandle, IntPtr realmPtr)
         {
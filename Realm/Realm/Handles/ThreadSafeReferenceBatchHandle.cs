@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+namespace Realms
+{
+    /// <summary>
+    /// Hands over many objects and collections to another thread at once. Unlike a <see cref="ThreadSafeReference"/>
+    /// per value, a batch pins a single version of the source Realm, which is released when the handle is disposed.
+    /// </summary>
+    internal class ThreadSafeReferenceBatchHandle : StandaloneHandle
+    {
+        private static class NativeMethods
+        {
+#pragma warning disable IDE1006 // Naming Styles
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "thread_safe_reference_batch_create", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr create(SharedRealmHandle realm, IntPtr[] values, ThreadSafeReference.Type[] types, IntPtr count, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "thread_safe_reference_batch_size", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr size(ThreadSafeReferenceBatchHandle batch);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "thread_safe_reference_batch_resolve", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void resolve(ThreadSafeReferenceBatchHandle batch, SharedRealmHandle realm, [Out] IntPtr[] results, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "thread_safe_reference_batch_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr handle);
+
+#pragma warning restore IDE1006 // Naming Styles
+        }
+
+        private ThreadSafeReferenceBatchHandle(IntPtr handle) : base(handle)
+        {
+        }
+
+        public int Count => (int)NativeMethods.size(this);
+
+        /// <summary>
+        /// Captures the values behind <paramref name="handles"/>, which must all belong to <paramref name="realm"/>.
+        /// </summary>
+        /// <param name="realm">The Realm the values belong to. It must not be in a write transaction.</param>
+        /// <param name="handles">The handles of the objects and collections to hand over.</param>
+        /// <param name="types">The type of the value behind each handle.</param>
+        /// <returns>A handle that can be resolved on any thread.</returns>
+        public static ThreadSafeReferenceBatchHandle Create(SharedRealmHandle realm, IReadOnlyList<RealmHandle> handles, ThreadSafeReference.Type[] types)
+        {
+            if (handles.Count != types.Length)
+            {
+                throw new ArgumentException("Every handle must have a matching type.", nameof(types));
+            }
+
+            var values = new IntPtr[handles.Count];
+            for (var i = 0; i < values.Length; i++)
+            {
+                values[i] = handles[i].DangerousGetHandle();
+            }
+
+            var result = NativeMethods.create(realm, values, types, (IntPtr)values.Length, out var ex);
+            GC.KeepAlive(handles);
+            ex.ThrowIfNecessary();
+
+            return new ThreadSafeReferenceBatchHandle(result);
+        }
+
+        /// <summary>
+        /// Imports the captured values into <paramref name="realm"/>, in the order they were captured in. The
+        /// returned pointers must be wrapped in the handle type matching their value.
+        /// </summary>
+        /// <param name="realm">The Realm to resolve the values in. Values deleted in its version come back invalid.</param>
+        /// <returns>The native pointers of the resolved values.</returns>
+        public IntPtr[] Resolve(SharedRealmHandle realm)
+        {
+            var results = new IntPtr[Count];
+            NativeMethods.resolve(this, realm, results, out var ex);
+            ex.ThrowIfNecessary();
+            return results;
+        }
+
+        protected override void Unbind() => NativeMethods.destroy(handle);
+    }
+}
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Threading.Tasks;
+using Realms.Native;
+
+namespace Realms
+{
+    /// <summary>
+    /// A queue of mutation batches that are applied by a dedicated native writer thread. Batches can be enqueued from
+    /// any thread and batches waiting at the same time share a single write transaction.
+    /// </summary>
+    internal class WriteQueueHandle : StandaloneHandle
+    {
+        private static class NativeMethods
+        {
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "write_queue_create", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr create(SharedRealmHandle realm, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "write_queue_close", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void close(IntPtr queue);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "write_queue_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr queue);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "write_queue_enqueue", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void enqueue(WriteQueueHandle queue, [MarshalAs(UnmanagedType.LPArray), In] QueuedMutation[] mutations, IntPtr count,
+                IntPtr tcs_ptr, out NativeException ex);
+        }
+
+        private WriteQueueHandle(IntPtr handle) : base(handle)
+        {
+        }
+
+        public static WriteQueueHandle Create(SharedRealmHandle realm)
+        {
+            var result = NativeMethods.create(realm, out var ex);
+            ex.ThrowIfNecessary();
+            return new WriteQueueHandle(result);
+        }
+
+        /// <summary>
+        /// Enqueues a batch of mutations. Each <see cref="QueuedMutationType.CreateObject"/> mutation starts a new object,
+        /// identified by its primary key if the type has one, and the <see cref="QueuedMutationType.SetValue"/> mutations
+        /// following it set its properties.
+        /// </summary>
+        /// <returns>A task that completes once the batch has been committed.</returns>
+        public async Task EnqueueAsync(IReadOnlyList<(QueuedMutationType Type, TableKey TableKey, IntPtr PropertyIndex, RealmValue Value)> mutations)
+        {
+            // The writer thread completes the task, so continuations must not run inline on it.
+            var tcs = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+            var tcsHandle = GCHandle.Alloc(tcs);
+
+            var nativeMutations = new QueuedMutation[mutations.Count];
+            var handles = new RealmValue.HandlesToCleanup?[mutations.Count];
+            try
+            {
+                for (var i = 0; i < mutations.Count; i++)
+                {
+                    var (type, tableKey, propertyIndex, value) = mutations[i];
+                    (var primitive, handles[i]) = value.ToNative();
+                    nativeMutations[i] = type == QueuedMutationType.CreateObject
+                        ? QueuedMutation.CreateObject(tableKey, primitive)
+                        : QueuedMutation.SetValue(propertyIndex, primitive);
+                }
+
+                NativeMethods.enqueue(this, nativeMutations, (IntPtr)nativeMutations.Length, GCHandle.ToIntPtr(tcsHandle), out var ex);
+
+                // The values are copied by the native queue, so they can be released before the batch is applied.
+                foreach (var handle in handles)
+                {
+                    handle?.Dispose();
+                }
+
+                ex.ThrowIfNecessary();
+
+                await tcs.Task;
+            }
+            finally
+            {
+                tcsHandle.Free();
+            }
+        }
+
+        /// <summary>
+        /// Disposing the handle waits for the enqueued batches to be applied. The finalizer must not block on the writer
+        /// thread, so if the handle is finalized instead, the writer thread applies them and exits on its own.
+        /// </summary>
+        protected override void Dispose(bool disposing)
+        {
+            if (disposing && !IsInvalid && !IsClosed)
+            {
+                NativeMethods.close(handle);
+            }
+
+            base.Dispose(disposing);
+        }
+
+        protected override void Unbind() => NativeMethods.destroy(handle);
+    }
+}
@@ -22,6 +22,14 @@ namespace System.Threading.Tasks
 {
     internal class TaskCompletionSource : TaskCompletionSource<object?>
     {
+        public TaskCompletionSource()
+        {
+        }
+
+        public TaskCompletionSource(TaskCreationOptions creationOptions) : base(creationOptions)
+        {
+        }
+
         public void TrySetResult() => TrySetResult(null);
     }
 }
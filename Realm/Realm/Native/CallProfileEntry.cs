@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms.Native
+{
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct CallProfileEntry
+    {
+        private StringValue name;
+
+        private ulong calls;
+
+        private ulong sampled_calls;
+
+        private ulong sampled_nanoseconds;
+
+        private ulong max_nanoseconds;
+
+        public string Name => name!;
+
+        public long Calls => (long)calls;
+
+        /// <summary>
+        /// Gets the mean latency of the sampled calls.
+        /// </summary>
+        public TimeSpan MeanDuration => sampled_calls == 0 ? TimeSpan.Zero : FromNanoseconds(sampled_nanoseconds / sampled_calls);
+
+        /// <summary>
+        /// Gets the estimated time spent in all calls, extrapolated from the sampled ones.
+        /// </summary>
+        public TimeSpan EstimatedTotalDuration => sampled_calls == 0 ? TimeSpan.Zero : FromNanoseconds(sampled_nanoseconds / sampled_calls * calls);
+
+        public TimeSpan MaxDuration => FromNanoseconds(max_nanoseconds);
+
+        private static TimeSpan FromNanoseconds(ulong nanoseconds) => TimeSpan.FromTicks((long)(nanoseconds / 100));
+    }
+}
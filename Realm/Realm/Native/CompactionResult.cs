@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms.Native
+{
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct CompactionResult
+    {
+        private ulong size_before;
+
+        private ulong size_after;
+
+        private double elapsed_seconds;
+
+        [MarshalAs(UnmanagedType.U1)]
+        private bool compacted;
+
+        public ulong SizeBefore => size_before;
+
+        public ulong SizeAfter => size_after;
+
+        public ulong BytesReclaimed => size_before > size_after ? size_before - size_after : 0;
+
+        public TimeSpan Elapsed => TimeSpan.FromSeconds(elapsed_seconds);
+
+        /// <summary>
+        /// Gets a value indicating whether the file was compacted. This is <c>false</c> if the Realm was open elsewhere.
+        /// </summary>
+        public bool Compacted => compacted;
+    }
+}
@@ -34,6 +34,8 @@ internal struct Configuration
 
         internal ulong max_number_of_active_versions;
 
+        internal ulong preallocate_size;
+
         internal IntPtr managed_config;
 
         internal MarshaledVector<byte> encryption_key;
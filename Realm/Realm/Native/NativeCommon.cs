@@ -19,6 +19,7 @@
 // file NativeCommon.cs provides mappings to common functions that don't fit the Table classes etc.
 using System;
 using System.Diagnostics;
+using System.Linq;
 using System.Runtime.InteropServices;
 using System.Threading;
 using Realms.Helpers;
@@ -39,6 +40,9 @@ internal static class NativeCommon
         [DllImport(InteropConfig.DLL_NAME, EntryPoint = "_realm_flip_guid_for_testing", CallingConvention = CallingConvention.Cdecl)]
         public static extern void flip_guid_for_testing([In, Out] byte[] guid_bytes);
 
+        [DllImport(InteropConfig.DLL_NAME, EntryPoint = "realm_get_call_profile", CallingConvention = CallingConvention.Cdecl)]
+        private static extern unsafe IntPtr get_call_profile(CallProfileEntry* buffer, IntPtr buffer_length, out NativeException ex);
+
         private static int _isInitialized;
 
         internal static void Initialize()
@@ -84,6 +88,32 @@ internal static void Initialize()
             }
         }
 
+        /// <summary>
+        /// Returns the number of calls and sampled latencies of every native function that has been called. This is always
+        /// empty unless the wrappers were built with <c>REALM_DOTNET_CALL_PROFILING</c>.
+        /// </summary>
+        public static unsafe CallProfileEntry[] GetCallProfile()
+        {
+            var entries = Array.Empty<CallProfileEntry>();
+            while (true)
+            {
+                int count;
+                fixed (CallProfileEntry* buffer = entries)
+                {
+                    count = (int)get_call_profile(buffer, (IntPtr)entries.Length, out var nativeException);
+                    nativeException.ThrowIfNecessary();
+                }
+
+                // More functions may have been called since the entries were counted, in which case we try again.
+                if (count <= entries.Length)
+                {
+                    return count == entries.Length ? entries : entries.Take(count).ToArray();
+                }
+
+                entries = new CallProfileEntry[count];
+            }
+        }
+
         /// <summary>
         /// **WARNING**: This will close all native Realm instances and AppHandles. This method is extremely unsafe
         /// to call in any circumstance where the user might be accessing anything Realm-related. The only places
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+
+namespace Realms.Native
+{
+#pragma warning disable IDE0049 // Use built-in type alias
+
+    /// <summary>
+    /// The keys identifying an object within a Realm. They never change for the lifetime of the object, so they can
+    /// be read once per handle and used to compare and hash objects without calling into native code.
+    /// </summary>
+    internal readonly struct ObjectKeys : IEquatable<ObjectKeys>
+    {
+        public readonly TableKey TableKey;
+
+        public readonly Int64 ObjKey;
+
+        public ObjectKeys(TableKey tableKey, Int64 objKey)
+        {
+            TableKey = tableKey;
+            ObjKey = objKey;
+        }
+
+        public bool Equals(ObjectKeys other) => TableKey == other.TableKey && ObjKey == other.ObjKey;
+
+        public override bool Equals(object? obj) => obj is ObjectKeys other && Equals(other);
+
+        public override int GetHashCode()
+        {
+            unchecked
+            {
+                var hashCode = -986587137;
+                hashCode = (hashCode * -1521134295) + (Int32)TableKey.Value;
+                hashCode = (hashCode * -1521134295) + (Int32)ObjKey;
+                return hashCode;
+            }
+        }
+
+        public static bool operator ==(ObjectKeys left, ObjectKeys right) => left.Equals(right);
+
+        public static bool operator !=(ObjectKeys left, ObjectKeys right) => !left.Equals(right);
+    }
+
+#pragma warning restore IDE0049 // Use built-in type alias
+}
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms.Native
+{
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct OpenRealmTimings
+    {
+        private ulong total_nanoseconds;
+
+        private ulong file_and_schema_nanoseconds;
+
+        private ulong should_compact_nanoseconds;
+
+        private ulong migration_nanoseconds;
+
+        private ulong initialization_nanoseconds;
+
+        private ulong guid_fix_nanoseconds;
+
+        private ulong initial_read_nanoseconds;
+
+        public TimeSpan Total => FromNanoseconds(total_nanoseconds);
+
+        /// <summary>
+        /// Gets the time spent opening and mapping the file and validating or migrating the schema, excluding the
+        /// time spent in managed callbacks.
+        /// </summary>
+        public TimeSpan FileAndSchema => FromNanoseconds(file_and_schema_nanoseconds);
+
+        public TimeSpan ShouldCompact => FromNanoseconds(should_compact_nanoseconds);
+
+        public TimeSpan Migration => FromNanoseconds(migration_nanoseconds);
+
+        public TimeSpan Initialization => FromNanoseconds(initialization_nanoseconds);
+
+        public TimeSpan GuidFix => FromNanoseconds(guid_fix_nanoseconds);
+
+        public TimeSpan InitialRead => FromNanoseconds(initial_read_nanoseconds);
+
+        private static TimeSpan FromNanoseconds(ulong nanoseconds) => TimeSpan.FromTicks((long)(nanoseconds / 100));
+    }
+}
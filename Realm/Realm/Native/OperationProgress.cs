@@ -0,0 +1,48 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+
+namespace Realms.Native
+{
+    /// <summary>
+    /// A snapshot of the progress of a long running native operation, such as an import.
+    /// </summary>
+    internal readonly struct OperationProgress
+    {
+        public ulong ProcessedUnits { get; }
+
+        public ulong ProcessedBytes { get; }
+
+        public ulong TotalBytes { get; }
+
+        public TimeSpan Elapsed { get; }
+
+        public double UnitsPerSecond => Elapsed > TimeSpan.Zero ? ProcessedUnits / Elapsed.TotalSeconds : 0;
+
+        public double BytesPerSecond => Elapsed > TimeSpan.Zero ? ProcessedBytes / Elapsed.TotalSeconds : 0;
+
+        public OperationProgress(ulong processedUnits, ulong processedBytes, ulong totalBytes, TimeSpan elapsed)
+        {
+            ProcessedUnits = processedUnits;
+            ProcessedBytes = processedBytes;
+            TotalBytes = totalBytes;
+            Elapsed = elapsed;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms.Native
+{
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct QueryExplanation
+    {
+        private IntPtr table_size;
+
+        private IntPtr matched_count;
+
+        private IntPtr result_count;
+
+        private ulong query_nanoseconds;
+
+        private ulong sort_nanoseconds;
+
+        private ulong descriptors_nanoseconds;
+
+        public int TableSize => (int)table_size;
+
+        public int MatchedCount => (int)matched_count;
+
+        public int ResultCount => (int)result_count;
+
+        public TimeSpan QueryDuration => FromNanoseconds(query_nanoseconds);
+
+        public TimeSpan SortDuration => FromNanoseconds(sort_nanoseconds);
+
+        public TimeSpan DescriptorsDuration => FromNanoseconds(descriptors_nanoseconds);
+
+        private static TimeSpan FromNanoseconds(ulong nanoseconds) => TimeSpan.FromTicks((long)(nanoseconds / 100));
+    }
+}
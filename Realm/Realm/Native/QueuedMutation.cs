@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms.Native
+{
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct QueuedMutation
+    {
+        public QueuedMutationType type;
+
+        public TableKey table_key;
+
+        public IntPtr property_index;
+
+        public PrimitiveValue value;
+
+        public static QueuedMutation CreateObject(TableKey tableKey, PrimitiveValue primaryKey) => new()
+        {
+            type = QueuedMutationType.CreateObject,
+            table_key = tableKey,
+            value = primaryKey,
+        };
+
+        public static QueuedMutation SetValue(IntPtr propertyIndex, PrimitiveValue value) => new()
+        {
+            type = QueuedMutationType.SetValue,
+            property_index = propertyIndex,
+            value = value,
+        };
+    }
+
+    internal enum QueuedMutationType : byte
+    {
+        CreateObject,
+        SetValue,
+    }
+}
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms.Native
+{
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct LatencySummary
+    {
+        private ulong count;
+
+        private ulong mean_ns;
+
+        private ulong p50_ns;
+
+        private ulong p90_ns;
+
+        private ulong p99_ns;
+
+        private ulong max_ns;
+
+        public long Count => (long)count;
+
+        public TimeSpan Mean => FromNanoseconds(mean_ns);
+
+        public TimeSpan P50 => FromNanoseconds(p50_ns);
+
+        public TimeSpan P90 => FromNanoseconds(p90_ns);
+
+        public TimeSpan P99 => FromNanoseconds(p99_ns);
+
+        public TimeSpan Max => FromNanoseconds(max_ns);
+
+        private static TimeSpan FromNanoseconds(ulong nanoseconds) => TimeSpan.FromTicks((long)(nanoseconds / 100));
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct TransactionMetrics
+    {
+        public LatencySummary WriteLockWait;
+
+        public LatencySummary Transaction;
+
+        public LatencySummary Commit;
+
+        public LatencySummary Refresh;
+    }
+}
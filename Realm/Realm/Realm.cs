@@ -150,6 +150,35 @@ public static bool Compact(RealmConfigurationBase? config = null)
             return realm.SharedRealmHandle.Compact();
         }
 
+        /// <summary>
+        /// Compacts a Realm file on a background thread. See <see cref="Compact"/> for details on compaction.
+        /// </summary>
+        /// <remarks>
+        /// The Realm file must not be open anywhere else while it's compacted, including on the calling thread.
+        /// The Realm is opened without a schema, so no migration or initial data callbacks are invoked.
+        /// Synchronized Realms can't be compacted in the background.
+        /// </remarks>
+        /// <param name="config">Optional configuration.</param>
+        /// <param name="cancellationToken">
+        /// An optional cancellation token. Compaction itself can't be interrupted, so cancelling only prevents it from starting.
+        /// </param>
+        /// <returns>
+        /// A task that completes with the number of bytes the file shrank by, or <c>null</c> if the file couldn't be compacted
+        /// because the Realm was open elsewhere.
+        /// </returns>
+        public static async Task<ulong?> CompactAsync(RealmConfigurationBase? config = null, CancellationToken cancellationToken = default)
+        {
+            config ??= RealmConfiguration.DefaultConfiguration;
+            if (config is not RealmConfiguration)
+            {
+                throw new NotSupportedException("Only local Realms can be compacted in the background.");
+            }
+
+            using var arena = new Arena();
+            var result = await SharedRealmHandle.CompactAsync(config.CreateNativeConfiguration(arena), onProgress: null, cancellationToken);
+            return result.Compacted ? result.BytesReclaimed : null;
+        }
+
         /// <summary>
         /// Deletes all files associated with a given Realm if the Realm exists and is not open.
         /// </summary>
@@ -332,6 +361,11 @@ internal Realm(SharedRealmHandle sharedRealmHandle, RealmConfigurationBase confi
             _state.AddRealm(this);
 
             SharedRealmHandle = sharedRealmHandle;
+            if (config.SlowQueryThreshold is TimeSpan slowQueryThreshold)
+            {
+                SharedRealmHandle.SetSlowQueryThreshold(slowQueryThreshold);
+            }
+
             Metadata = metadata ?? new RealmMetadata(schema.Select(CreateRealmObjectMetadata));
             Schema = schema;
             IsFrozen = SharedRealmHandle.IsFrozen;
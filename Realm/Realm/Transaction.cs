@@ -131,7 +131,7 @@ public async Task CommitAsync(CancellationToken cancellationToken = default)
                 return;
             }
 
-            await _realm.SharedRealmHandle.CommitTransactionAsync(synchronizationContext, cancellationToken);
+            await _realm.SharedRealmHandle.CommitTransactionAsync(synchronizationContext, _realm.Config.GroupAsyncCommits, cancellationToken);
             FinishTransaction(TransactionState.Committed);
         }
 
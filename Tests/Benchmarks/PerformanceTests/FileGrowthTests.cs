@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System.Linq;
+using BenchmarkDotNet.Attributes;
+using Realms;
+
+namespace PerformanceTests
+{
+    /// <summary>
+    /// This suite compares write and scan throughput of a Realm that grows as needed with one
+    /// whose file was preallocated with <see cref="RealmConfigurationBase.PreallocateFileSize"/>.
+    /// </summary>
+    public partial class FileGrowthTests : BenchmarkBase
+    {
+        private const int BatchSize = 10_000;
+
+        private const int SeedCount = 100_000;
+
+        private readonly string _payload = new('x', 256);
+
+        [Params(0UL, 256UL * 1024 * 1024)]
+        public ulong PreallocateFileSize { get; set; }
+
+        protected override void SeedData()
+        {
+            base.SeedData();
+
+            // Preallocation only applies to existing files, so the file is created before it's reopened.
+            var config = new RealmConfiguration(_realm.Config.DatabasePath)
+            {
+                PreallocateFileSize = PreallocateFileSize,
+            };
+
+            _realm.Write(() => _realm.Add(new GrowthObject { Value = -1 }));
+            _realm.Dispose();
+            _realm = Realm.GetInstance(config);
+
+            _realm.Write(() =>
+            {
+                for (var i = 0; i < SeedCount; i++)
+                {
+                    _realm.Add(new GrowthObject
+                    {
+                        Value = i,
+                        Payload = _payload,
+                    });
+                }
+            });
+        }
+
+        [Benchmark(Description = "Insert a batch of objects into a growing file")]
+        public void Insert()
+        {
+            _realm.Write(() =>
+            {
+                for (var i = 0; i < BatchSize; i++)
+                {
+                    _realm.Add(new GrowthObject
+                    {
+                        Value = i,
+                        Payload = _payload,
+                    });
+                }
+            });
+        }
+
+        [Benchmark(Description = "Scan all objects in a file that grew while seeding")]
+        public long Scan()
+        {
+            return _realm.All<GrowthObject>().AsEnumerable().Sum(o => o.Value);
+        }
+
+        protected partial class GrowthObject : IRealmObject
+        {
+            public long Value { get; set; }
+
+            public string? Payload { get; set; }
+        }
+    }
+}
@@ -24,6 +24,8 @@
 using System.Threading.Tasks;
 using Nito.AsyncEx;
 using NUnit.Framework;
+using Realms.Exceptions;
+using Realms.Native;
 
 namespace Realms.Tests.Database
 {
@@ -73,6 +75,85 @@ static async Task<long> MeasureTiming(Func<Task> func)
             });
         }
 
+        [Test]
+        public void WaitForVersionAsync_CompletesWaitersInVersionOrder()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var obj = _realm.Write(() => _realm.Add(new IntPrimaryKeyWithValueObject()));
+                var reference = ThreadSafeReference.Create(obj);
+
+                // The waiters are registered, latest version first, before the writes that create those versions are committed.
+                var currentVersion = _realm.SharedRealmHandle.GetTransactionVersion();
+                var versions = Enumerable.Range(1, 3).Select(i => currentVersion + (ulong)i).ToArray();
+
+                var completed = new List<ulong>();
+                var waiters = versions.Reverse().Select(async v =>
+                {
+                    await _realm.SharedRealmHandle.WaitForVersionAsync(v);
+                    completed.Add(v);
+                    Assert.That(_realm.SharedRealmHandle.GetTransactionVersion(), Is.GreaterThanOrEqualTo(v));
+                }).ToArray();
+
+                Assert.That(waiters.Any(w => w.IsCompleted), Is.False);
+
+                var writtenVersions = await Task.Run(() =>
+                {
+                    using var realm = GetRealm(_realm.Config);
+                    var bgObj = realm.ResolveReference(reference)!;
+                    return Enumerable.Range(1, 3).Select(i =>
+                    {
+                        realm.Write(() => bgObj.StringValue = i.ToString());
+                        return realm.SharedRealmHandle.GetTransactionVersion();
+                    }).ToArray();
+                });
+
+                Assert.That(writtenVersions, Is.EqualTo(versions));
+
+                await Task.WhenAll(waiters);
+
+                Assert.That(completed, Is.EqualTo(versions));
+                Assert.That(obj.StringValue, Is.EqualTo("3"));
+
+                // Waiting for a version the Realm has already reached completes synchronously.
+                Assert.That(_realm.SharedRealmHandle.WaitForVersionAsync(versions[0]).IsCompleted);
+            });
+        }
+
+        [Test]
+        public void BackgroundQueries_EvaluateAgainstFrozenRealm()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                _realm.Write(() =>
+                {
+                    for (var i = 1; i <= 100; i++)
+                    {
+                        _realm.Add(new IntPropertyObject { Int = i });
+                    }
+                });
+
+                var metadata = _realm.Metadata[nameof(IntPropertyObject)];
+                var intIndex = metadata.GetPropertyIndex(nameof(IntPropertyObject.Int));
+                var query = (RealmResults<IntPropertyObject>)_realm.All<IntPropertyObject>().Where(o => o.Int > 50);
+
+                Assert.That(await query.ResultsHandle.CountAsync(), Is.EqualTo(50));
+                Assert.That((await query.ResultsHandle.AggregateAsync(intIndex, AggregateType.Sum)).AsInt64(), Is.EqualTo(3775));
+                Assert.That((await query.ResultsHandle.AggregateAsync(intIndex, AggregateType.Max)).AsInt64(), Is.EqualTo(100));
+                Assert.That((await query.ResultsHandle.AggregateAsync(intIndex, AggregateType.Average)).AsDouble(), Is.EqualTo(75.5));
+
+                var empty = (RealmResults<IntPropertyObject>)_realm.All<IntPropertyObject>().Where(o => o.Int > 1000);
+                Assert.That((await empty.ResultsHandle.AggregateAsync(intIndex, AggregateType.Min)).Type, Is.EqualTo(RealmValueType.Null));
+
+                using var snapshot = await query.ResultsHandle.SnapshotAsync();
+
+                // The snapshot belongs to the version the query was started at.
+                _realm.Write(() => _realm.Add(new IntPropertyObject { Int = 200 }));
+                Assert.That(snapshot.Count(), Is.EqualTo(50));
+                Assert.That(await query.ResultsHandle.CountAsync(), Is.EqualTo(51));
+            });
+        }
+
         [Test]
         public void RefreshAsync_OnABackgroundThread_RunsSynchronously()
         {
@@ -147,6 +228,120 @@ public void AsyncBeginWriteAndCommit()
             });
         }
 
+        [Test]
+        public void AsyncCommits_WhenGrouped_AllComplete()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var config = new RealmConfiguration(Guid.NewGuid().ToString())
+                {
+                    GroupAsyncCommits = true
+                };
+                using var realm = GetRealm(config);
+
+                var writes = Enumerable.Range(0, 20).Select(i => realm.WriteAsync(() =>
+                {
+                    realm.Add(new Person { FullName = $"Person {i}" });
+                }));
+
+                await Task.WhenAll(writes);
+
+                Assert.That(realm.All<Person>().Count(), Is.EqualTo(20));
+            });
+        }
+
+        [Test]
+        public void TransactionMetrics_RecordSyncAndAsyncWrites()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                Assert.That(_realm.SharedRealmHandle.GetMetrics(), Is.Null);
+
+                _realm.SharedRealmHandle.SetMetricsEnabled(true);
+
+                _realm.Write(() => _realm.Add(new Person { FullName = "Sync" }));
+                await _realm.WriteAsync(() => _realm.Add(new Person { FullName = "Async" }));
+                _realm.Refresh();
+
+                var metrics = _realm.SharedRealmHandle.GetMetrics()!.Value;
+                Assert.That(metrics.WriteLockWait.Count, Is.EqualTo(2));
+                Assert.That(metrics.Transaction.Count, Is.EqualTo(2));
+                Assert.That(metrics.Commit.Count, Is.EqualTo(2));
+                Assert.That(metrics.Refresh.Count, Is.GreaterThanOrEqualTo(1));
+                Assert.That(metrics.Commit.P50, Is.LessThanOrEqualTo(metrics.Commit.Max));
+                Assert.That(metrics.Commit.Max, Is.GreaterThan(TimeSpan.Zero));
+
+                _realm.SharedRealmHandle.SetMetricsEnabled(false);
+                Assert.That(_realm.SharedRealmHandle.GetMetrics(), Is.Null);
+            });
+        }
+
+        [Test]
+        public void WriteQueue_AppliesBatchesFromManyThreads()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var metadata = _realm.Metadata[nameof(IntPrimaryKeyWithValueObject)];
+                var valueIndex = metadata.GetPropertyIndex(nameof(IntPrimaryKeyWithValueObject.StringValue));
+
+                using var queue = WriteQueueHandle.Create(_realm.SharedRealmHandle);
+
+                var producers = Enumerable.Range(0, 10).Select(i => Task.Run(() => queue.EnqueueAsync(new[]
+                {
+                    (QueuedMutationType.CreateObject, metadata.TableKey, IntPtr.Zero, (RealmValue)i),
+                    (QueuedMutationType.SetValue, default(TableKey), valueIndex, (RealmValue)$"value {i}"),
+                })));
+
+                await Task.WhenAll(producers);
+
+                _realm.Refresh();
+                Assert.That(_realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(10));
+                Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(7)!.StringValue, Is.EqualTo("value 7"));
+            });
+        }
+
+        [Test]
+        public void WriteQueue_WhenBatchFails_OnlyFailsThatBatch()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var metadata = _realm.Metadata[nameof(RequiredPrimaryKeyStringObject)];
+
+                using var queue = WriteQueueHandle.Create(_realm.SharedRealmHandle);
+
+                var good = queue.EnqueueAsync(new[] { (QueuedMutationType.CreateObject, metadata.TableKey, IntPtr.Zero, (RealmValue)"a") });
+                var bad = queue.EnqueueAsync(new[] { (QueuedMutationType.CreateObject, metadata.TableKey, IntPtr.Zero, RealmValue.Null) });
+
+                await good;
+                await TestHelpers.AssertThrows<RealmException>(() => bad);
+
+                _realm.Refresh();
+                Assert.That(_realm.All<RequiredPrimaryKeyStringObject>().Count(), Is.EqualTo(1));
+            });
+        }
+
+        [Test]
+        public void WriteQueue_Dispose_WaitsForPendingBatches()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var metadata = _realm.Metadata[nameof(IntPrimaryKeyWithValueObject)];
+
+                var queue = WriteQueueHandle.Create(_realm.SharedRealmHandle);
+                var pending = Enumerable.Range(0, 100)
+                    .Select(i => queue.EnqueueAsync(new[] { (QueuedMutationType.CreateObject, metadata.TableKey, IntPtr.Zero, (RealmValue)i) }))
+                    .ToArray();
+
+                queue.Dispose();
+
+                // The batches were committed before Dispose returned, even if their tasks complete asynchronously
+                _realm.Refresh();
+                Assert.That(_realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(100));
+
+                await Task.WhenAll(pending);
+            });
+        }
+
         [Test]
         public void AsyncBeginWrite_RollBack_DoesNotPersistData()
         {
@@ -751,6 +751,41 @@ public void GetBacklinksFromType_WhenFromPropertyExists_Succeeds()
             });
         }
 
+        [Test]
+        public void GetBacklinkCount_CountsBacklinksFromTheGivenOrigin()
+        {
+            RunTestInAllModes((realm, _) =>
+            {
+                var guid = Guid.NewGuid();
+                var obj = realm.Write(() =>
+                {
+                    var intPropObj = (IRealmObject)realm.DynamicApi.CreateObject(nameof(IntPropertyObject), ObjectId.GenerateNewId());
+
+                    for (var i = 0; i < 3; i++)
+                    {
+                        var collectionsObj = realm.DynamicApi.CreateObject(nameof(SyncCollectionsObject), ObjectId.GenerateNewId());
+                        collectionsObj.DynamicApi.GetList<IRealmObject>(nameof(SyncCollectionsObject.ObjectList)).Add(intPropObj);
+                        if (i == 0)
+                        {
+                            collectionsObj.DynamicApi.Set(nameof(SyncCollectionsObject.GuidProperty), guid);
+                            collectionsObj.DynamicApi.GetSet<IRealmObject>(nameof(SyncCollectionsObject.ObjectSet)).Add(intPropObj);
+                        }
+                    }
+
+                    return intPropObj;
+                });
+
+                Assert.That(obj.DynamicApi.GetBacklinkCount(nameof(IntPropertyObject.ContainingCollections)), Is.EqualTo(3));
+                Assert.That(obj.DynamicApi.GetBacklinkCountFromType(nameof(SyncCollectionsObject), nameof(SyncCollectionsObject.ObjectList)), Is.EqualTo(3));
+                Assert.That(obj.DynamicApi.GetBacklinkCountFromType(nameof(SyncCollectionsObject), nameof(SyncCollectionsObject.ObjectSet)), Is.EqualTo(1));
+                Assert.Throws<ArgumentException>(() => obj.DynamicApi.GetBacklinkCount(nameof(IntPropertyObject.Int)));
+
+                var filtered = obj.DynamicApi.GetBacklinks(nameof(IntPropertyObject.ContainingCollections)).Filter("GuidProperty == $0", guid);
+                Assert.That(filtered.Count(), Is.EqualTo(1));
+                Assert.That(filtered.Single().DynamicApi.Get<Guid>(nameof(SyncCollectionsObject.GuidProperty)), Is.EqualTo(guid));
+            });
+        }
+
         #endregion Dynamic.GetBacklinks
 
         #region Dynamic.GetList
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using NUnit.Framework;
+using Realms.Native;
+
+namespace Realms.Tests.Database
+{
+    [TestFixture, Preserve(AllMembers = true)]
+    public class ImportTests : RealmInstanceTest
+    {
+        [Test]
+        public void ImportFile_WhenNDJson_CreatesAndUpdatesObjects()
+        {
+            _realm.Write(() => _realm.Add(new IntPrimaryKeyWithValueObject { Id = 2, StringValue = "old" }));
+
+            var path = WriteTempFile("{\"_id\": 1, \"StringValue\": \"one\"}\n{\"_id\": 2, \"StringValue\": \"two\", \"Unknown\": true}\n{\"_id\": 3}");
+
+            var progress = new List<OperationProgress>();
+            var imported = ImportFile<IntPrimaryKeyWithValueObject>(path, ImportFormat.NDJson, chunkSize: 2, p =>
+            {
+                progress.Add(p);
+                return true;
+            });
+
+            Assert.That(imported, Is.EqualTo(3));
+            Assert.That(_realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(3));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(1)!.StringValue, Is.EqualTo("one"));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(2)!.StringValue, Is.EqualTo("two"));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(3)!.StringValue, Is.Null);
+
+            Assert.That(progress.Select(p => p.ProcessedUnits), Is.EqualTo(new ulong[] { 2, 3 }));
+            Assert.That(progress.Last().ProcessedBytes, Is.EqualTo(new FileInfo(path).Length));
+        }
+
+        [Test]
+        public void ImportFile_WhenCsv_HandlesQuotedFields()
+        {
+            var path = WriteTempFile("_id,StringValue\r\n1,\"with, comma\"\r\n2,\"with \"\"quotes\"\"\nand a line break\"\r\n");
+
+            var imported = ImportFile<IntPrimaryKeyWithValueObject>(path, ImportFormat.Csv, chunkSize: 100, onProgress: null);
+
+            Assert.That(imported, Is.EqualTo(2));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(1)!.StringValue, Is.EqualTo("with, comma"));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(2)!.StringValue, Is.EqualTo("with \"quotes\"\nand a line break"));
+        }
+
+        [Test]
+        public void ImportFile_WhenProgressReturnsFalse_StopsAfterChunk()
+        {
+            var path = WriteTempFile(string.Join("\n", Enumerable.Range(0, 10).Select(i => $"{{\"_id\": {i}}}")));
+
+            var imported = ImportFile<IntPrimaryKeyWithValueObject>(path, ImportFormat.NDJson, chunkSize: 4, _ => false);
+
+            Assert.That(imported, Is.EqualTo(4));
+            Assert.That(_realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(4));
+        }
+
+        [Test]
+        public void Export_WhenNDJson_CanBeImportedAgain()
+        {
+            _realm.Write(() =>
+            {
+                _realm.Add(new IntPrimaryKeyWithValueObject { Id = 1, StringValue = "one" });
+                _realm.Add(new IntPrimaryKeyWithValueObject { Id = 2 });
+            });
+
+            var path = Path.GetTempFileName();
+            var query = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>();
+            var exported = query.ResultsHandle.Export(path, Array.Empty<IntPtr>(), ExportFormat.NDJson, batchSize: 1);
+
+            Assert.That(exported, Is.EqualTo(2));
+            Assert.That(File.ReadAllLines(path), Is.EqualTo(new[] { "{\"StringValue\":\"one\",\"_id\":1}", "{\"StringValue\":null,\"_id\":2}" }));
+
+            _realm.Write(() => _realm.RemoveAll<IntPrimaryKeyWithValueObject>());
+
+            Assert.That(ImportFile<IntPrimaryKeyWithValueObject>(path, ImportFormat.NDJson, chunkSize: 100, onProgress: null), Is.EqualTo(2));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(1)!.StringValue, Is.EqualTo("one"));
+        }
+
+        [Test]
+        public void Export_WhenColumnar_WritesSchemaAndBatches()
+        {
+            _realm.Write(() =>
+            {
+                _realm.Add(new IntPrimaryKeyWithValueObject { Id = 1, StringValue = "one" });
+                _realm.Add(new IntPrimaryKeyWithValueObject { Id = 2 });
+                _realm.Add(new IntPrimaryKeyWithValueObject { Id = 3, StringValue = "three" });
+            });
+
+            var path = Path.GetTempFileName();
+            var metadata = _realm.Metadata[nameof(IntPrimaryKeyWithValueObject)];
+            var query = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>();
+            query.ResultsHandle.Export(path, new[] { metadata.GetPropertyIndex("_id") }, ExportFormat.Columnar, batchSize: 2);
+
+            using var reader = new BinaryReader(File.OpenRead(path));
+            Assert.That(new string(reader.ReadChars(8)), Is.EqualTo("RLMCOL01"));
+            Assert.That(reader.ReadUInt32(), Is.EqualTo(1));
+            Assert.That(new string(reader.ReadChars(reader.ReadUInt16())), Is.EqualTo("_id"));
+            Assert.That(reader.ReadByte(), Is.EqualTo((byte)RealmValueType.Int));
+            Assert.That(reader.ReadByte(), Is.EqualTo(0));
+
+            Assert.That(reader.ReadUInt32(), Is.EqualTo(2));
+            Assert.That(reader.ReadByte(), Is.EqualTo(0b11));
+            Assert.That(new[] { reader.ReadInt64(), reader.ReadInt64() }, Is.EqualTo(new[] { 1L, 2L }));
+
+            Assert.That(reader.ReadUInt32(), Is.EqualTo(1));
+            Assert.That(reader.ReadByte(), Is.EqualTo(0b1));
+            Assert.That(reader.ReadInt64(), Is.EqualTo(3));
+
+            Assert.That(reader.ReadUInt32(), Is.EqualTo(0));
+        }
+
+        [Test]
+        public void Export_WhenNDJson_RoundTripsBinaryDataAndDatesOutsideTheNanosecondRange()
+        {
+            var date = new DateTimeOffset(1, 1, 1, 0, 0, 0, 123, TimeSpan.Zero);
+            _realm.Write(() =>
+            {
+                _realm.Add(new AllTypesObject { DateTimeOffsetProperty = date, ByteArrayProperty = new byte[] { 1, 2, 3 } });
+            });
+
+            var path = Path.GetTempFileName();
+            var metadata = _realm.Metadata[nameof(AllTypesObject)];
+            var properties = new[] { metadata.GetPropertyIndex(nameof(AllTypesObject.DateTimeOffsetProperty)), metadata.GetPropertyIndex(nameof(AllTypesObject.ByteArrayProperty)) };
+            var query = (RealmResults<AllTypesObject>)_realm.All<AllTypesObject>();
+            query.ResultsHandle.Export(path, properties, ExportFormat.NDJson, batchSize: 1);
+
+            Assert.That(File.ReadAllLines(path), Is.EqualTo(new[] { $"{{\"ByteArrayProperty\":\"AQID\",\"DateTimeOffsetProperty\":{date.ToUnixTimeMilliseconds()}}}" }));
+
+            _realm.Write(() => _realm.RemoveAll<AllTypesObject>());
+
+            Assert.That(ImportFile<AllTypesObject>(path, ImportFormat.NDJson, chunkSize: 100, onProgress: null), Is.EqualTo(1));
+
+            var imported = _realm.All<AllTypesObject>().Single();
+            Assert.That(imported.DateTimeOffsetProperty, Is.EqualTo(date));
+            Assert.That(imported.ByteArrayProperty, Is.EqualTo(new byte[] { 1, 2, 3 }));
+        }
+
+        [Test]
+        public void Export_WhenColumnar_WritesDatesAsSecondsAndNanoseconds()
+        {
+            var date = new DateTimeOffset(9999, 12, 31, 0, 0, 0, 500, TimeSpan.Zero);
+            _realm.Write(() =>
+            {
+                _realm.Add(new AllTypesObject { DateTimeOffsetProperty = date });
+            });
+
+            var path = Path.GetTempFileName();
+            var metadata = _realm.Metadata[nameof(AllTypesObject)];
+            var query = (RealmResults<AllTypesObject>)_realm.All<AllTypesObject>();
+            query.ResultsHandle.Export(path, new[] { metadata.GetPropertyIndex(nameof(AllTypesObject.DateTimeOffsetProperty)) }, ExportFormat.Columnar, batchSize: 10);
+
+            using var reader = new BinaryReader(File.OpenRead(path));
+            reader.ReadChars(8);
+            Assert.That(reader.ReadUInt32(), Is.EqualTo(1));
+            reader.ReadChars(reader.ReadUInt16());
+            Assert.That(reader.ReadByte(), Is.EqualTo((byte)RealmValueType.Date));
+            reader.ReadByte();
+
+            Assert.That(reader.ReadUInt32(), Is.EqualTo(1));
+            Assert.That(reader.ReadByte(), Is.EqualTo(0b1));
+            Assert.That(reader.ReadInt64(), Is.EqualTo(date.ToUnixTimeSeconds()));
+            Assert.That(reader.ReadInt32(), Is.EqualTo(500_000_000));
+
+            Assert.That(reader.ReadUInt32(), Is.EqualTo(0));
+        }
+
+        private ulong ImportFile<T>(string path, ImportFormat format, int chunkSize, Func<OperationProgress, bool>? onProgress)
+            where T : IRealmObject
+        {
+            var tableKey = _realm.Metadata[typeof(T).Name].TableKey;
+            return _realm.SharedRealmHandle.ImportFile(tableKey, path, format, chunkSize, memoryBudget: 0, onProgress);
+        }
+
+        private static string WriteTempFile(string contents)
+        {
+            var path = Path.GetTempFileName();
+            File.WriteAllText(path, contents);
+            return path;
+        }
+    }
+}
@@ -29,10 +29,13 @@
 using System.Reflection;
 using System.Runtime.InteropServices;
 using System.Text.RegularExpressions;
+using System.Threading;
 using System.Threading.Tasks;
 using NUnit.Framework;
 using Realms.Exceptions;
+using Realms.Extensions;
 using Realms.Logging;
+using Realms.Native;
 using Realms.Schema;
 
 namespace Realms.Tests.Database
@@ -95,6 +98,72 @@ public void GetInstanceWithJustFilenameTest()
             }
         }
 
+        [Test]
+        public void GetInstance_RecordsOpenTimings()
+        {
+            var config = new RealmConfiguration(Guid.NewGuid().ToString());
+            GetRealm(config).Dispose();
+
+            config.ShouldCompactOnLaunch = (_, _) =>
+            {
+                Task.Delay(50).Wait();
+                return false;
+            };
+
+            using var realm = GetRealm(config);
+
+            var timings = SharedRealmHandle.GetLastOpenTimings();
+            Assert.That(timings.ShouldCompact, Is.GreaterThanOrEqualTo(TimeSpan.FromMilliseconds(40)));
+            Assert.That(timings.Migration, Is.EqualTo(TimeSpan.Zero));
+            Assert.That(timings.Total, Is.GreaterThanOrEqualTo(timings.FileAndSchema + timings.ShouldCompact + timings.GuidFix + timings.InitialRead));
+        }
+
+        [Test]
+        public void PreallocateFileSize_ExtendsExistingFile()
+        {
+            var config = new RealmConfiguration(Guid.NewGuid().ToString());
+            using (var realm = GetRealm(config))
+            {
+                AddDummyData(realm);
+            }
+
+            const long preallocateSize = 64 * 1024 * 1024;
+            Assert.That(new FileInfo(config.DatabasePath).Length, Is.LessThan(preallocateSize));
+
+            config.PreallocateFileSize = preallocateSize;
+            using (var realm = GetRealm(config))
+            {
+                Assert.That(new FileInfo(config.DatabasePath).Length, Is.GreaterThanOrEqualTo(preallocateSize));
+                Assert.That(realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(DummyDataSize / 2));
+
+                realm.Write(() => realm.Add(new IntPrimaryKeyWithValueObject { Id = -1 }));
+            }
+
+            using (var realm = GetRealm(config))
+            {
+                Assert.That(realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(DummyDataSize / 2 + 1));
+            }
+        }
+
+        [Test]
+        public void Prewarm_ReadsUpToBudget()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                using var realm = GetRealm();
+                AddDummyData(realm);
+
+                var fileSize = (ulong)new FileInfo(realm.Config.DatabasePath).Length;
+                Assert.That(await realm.SharedRealmHandle.PrewarmAsync(Array.Empty<TableKey>(), ulong.MaxValue), Is.EqualTo(fileSize));
+                Assert.That(await realm.SharedRealmHandle.PrewarmAsync(Array.Empty<TableKey>(), 4096), Is.EqualTo(4096));
+
+                var tableKey = realm.Metadata[nameof(IntPrimaryKeyWithValueObject)].TableKey;
+                var touched = await realm.SharedRealmHandle.PrewarmAsync(new[] { tableKey }, ulong.MaxValue);
+                Assert.That(touched, Is.GreaterThan(0));
+                Assert.That(await realm.SharedRealmHandle.PrewarmAsync(new[] { tableKey }, touched / 2), Is.LessThan(touched));
+            });
+        }
+
         [Test]
         public void DeleteRealmWorksIfClosed()
         {
@@ -366,6 +435,44 @@ public void Compact_WhenInTransaction_ShouldThrow()
             }, Throws.TypeOf<RealmInvalidTransactionException>());
         }
 
+        [Test]
+        public void CompactAsync_ShouldReduceSize()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var config = new RealmConfiguration(Guid.NewGuid().ToString());
+                using (var realm = GetRealm(config))
+                {
+                    AddDummyData(realm);
+                }
+
+                var initialSize = new FileInfo(config.DatabasePath).Length;
+                var reclaimed = await Realm.CompactAsync(config);
+
+                var finalSize = new FileInfo(config.DatabasePath).Length;
+                Assert.That(reclaimed, Is.EqualTo(initialSize - finalSize));
+
+                using (var realm = GetRealm(config))
+                {
+                    Assert.That(realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(DummyDataSize / 2));
+                }
+            });
+        }
+
+        [Test]
+        public void CompactAsync_WhenOpen_ReturnsNull()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                using var realm = GetRealm();
+                AddDummyData(realm);
+
+                var initialSize = new FileInfo(realm.Config.DatabasePath).Length;
+                Assert.That(await Realm.CompactAsync(realm.Config), Is.Null);
+                Assert.That(new FileInfo(realm.Config.DatabasePath).Length, Is.EqualTo(initialSize));
+            });
+        }
+
         [Test]
         public void Compact_WhenOpenOnDifferentThread_ShouldReturnFalse()
         {
@@ -634,6 +741,80 @@ public void GetInstanceAsync_ExecutesMigrationsInBackground()
             });
         }
 
+        [Test]
+        public void GetInstanceAsync_WhenCancelled_Throws()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var config = new RealmConfiguration(Guid.NewGuid().ToString());
+                GetRealm(config).Dispose();
+
+                var migrationsStarted = 0;
+                var migrationsCompleted = 0;
+                config.SchemaVersion = 2;
+                config.MigrationCallback = (_, _) =>
+                {
+                    Interlocked.Increment(ref migrationsStarted);
+                    Task.Delay(500).Wait();
+                    Interlocked.Increment(ref migrationsCompleted);
+                };
+
+                using var cts = new CancellationTokenSource(100);
+                await TestHelpers.AssertThrows<TaskCanceledException>(() => GetRealmAsync(config, cancellationToken: cts.Token));
+
+                // A migration that already started can't be interrupted, so the background open commits it and the
+                // synchronous open waits for the write lock and finds the file already migrated.
+                using var realm = GetRealm(config);
+                Assert.That(migrationsStarted, Is.EqualTo(1));
+                Assert.That(migrationsCompleted, Is.EqualTo(1));
+            });
+        }
+
+        [Test]
+        public void GetInstanceAsync_ReportsProgressBeforeCompactingAndMigrating()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var config = new RealmConfiguration(Guid.NewGuid().ToString());
+                GetRealm(config).Dispose();
+
+                var progress = new List<LocalOpenProgress>();
+                config.SchemaVersion = 2;
+                config.MigrationCallback = (_, _) => { };
+                config.ShouldCompactOnLaunch = (_, _) => true;
+                config.OnOpenProgress = progress.Add;
+
+                using var realm = await GetRealmAsync(config);
+
+                Assert.That(progress.Count, Is.EqualTo(2));
+                Assert.That(progress[0].CompactedFileSize, Is.GreaterThan(0));
+                Assert.That(progress[1].CompactedFileSize, Is.EqualTo(0));
+            });
+        }
+
+        [Test]
+        public void GetInstanceAsync_LogsOpenTimings()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var config = new RealmConfiguration(Guid.NewGuid().ToString());
+                GetRealm(config).Dispose();
+
+                var logger = new RealmLogger.InMemoryLogger();
+                RealmLogger.Default = logger;
+                RealmLogger.SetLogLevel(LogLevel.Debug);
+
+                config.SchemaVersion = 2;
+                config.MigrationCallback = (_, _) => Task.Delay(50).Wait();
+
+                using var realm = await GetRealmAsync(config);
+
+                var match = Regex.Match(logger.GetLog(), "Opened Realm at path .* migration: (\\d+) us");
+                Assert.That(match.Success, Is.True);
+                Assert.That(long.Parse(match.Groups[1].Value), Is.GreaterThanOrEqualTo(40_000));
+            });
+        }
+
         [Test]
         public void WriteEncryptedCopy_WhenEncryptionKeyProvided_WritesACopy([Values(true, false)] bool originalEncrypted,
                                                                              [Values(true, false)] bool copyEncrypted)
@@ -997,6 +1178,64 @@ public void Realm_Freeze_ReadOnly()
             frozenRealm.Dispose();
         }
 
+        [Test]
+        public void Realm_FreezeMany_FreezesAgainstOneFrozenRealm()
+        {
+            using var realm = GetRealm();
+            var objects = Enumerable.Range(0, 10).Select(i => new IntPropertyObject { Int = i }).ToArray();
+            realm.Write(() => realm.Add(objects));
+
+            var query = realm.All<IntPropertyObject>().Where(o => o.Int >= 5);
+            var handles = objects.Select(o => (RealmHandle)o.GetObjectHandle()!).Append(((RealmResults<IntPropertyObject>)query).ResultsHandle).ToArray();
+            var types = objects.Select(_ => ThreadSafeReference.Type.Object).Append(ThreadSafeReference.Type.Query).ToArray();
+
+            using var frozenRealm = realm.Freeze();
+            var frozen = frozenRealm.SharedRealmHandle.FreezeMany(handles, types);
+
+            realm.Write(() => realm.RemoveAll<IntPropertyObject>());
+
+            var metadata = frozenRealm.Metadata[nameof(IntPropertyObject)];
+            for (var i = 0; i < objects.Length; i++)
+            {
+                var obj = (IntPropertyObject)frozenRealm.MakeObject(metadata, new ObjectHandle(frozenRealm.SharedRealmHandle, frozen[i]));
+                Assert.That(obj.IsFrozen);
+                Assert.That(obj.Int, Is.EqualTo(i));
+            }
+
+            using var frozenResults = new ResultsHandle(frozenRealm.SharedRealmHandle, frozen[objects.Length]);
+            Assert.That(frozenResults.Count(), Is.EqualTo(5));
+
+            Assert.That(() => realm.SharedRealmHandle.FreezeMany(handles.Take(1).ToArray(), types.Take(1).ToArray()), Throws.InstanceOf<ArgumentException>());
+        }
+
+        [Test]
+        public void GetCallProfile_CountsCallsAndSamplesTheirDuration()
+        {
+            using var realm = GetRealm();
+            if (NativeCommon.GetCallProfile().Length == 0)
+            {
+                Assert.Ignore("The wrappers were built without REALM_DOTNET_CALL_PROFILING.");
+            }
+
+            // An export that hasn't been called yet has no entry, which reads as 0 calls.
+            static CallProfileEntry GetEntry(string name) => NativeCommon.GetCallProfile().SingleOrDefault(e => e.Name == name);
+
+            var commitsBefore = GetEntry("shared_realm_commit_transaction").Calls;
+
+            for (var i = 0; i < 20; i++)
+            {
+                realm.Write(() => realm.Add(new IntPropertyObject { Int = i }));
+            }
+
+            var commits = GetEntry("shared_realm_commit_transaction");
+            Assert.That(commits.Calls - commitsBefore, Is.EqualTo(20));
+
+            // The first call on a thread is always sampled, and a commit takes well over the 100 ns resolution of a TimeSpan.
+            Assert.That(commits.MeanDuration, Is.GreaterThan(TimeSpan.Zero));
+            Assert.That(commits.MaxDuration, Is.GreaterThanOrEqualTo(commits.MeanDuration));
+            Assert.That(commits.EstimatedTotalDuration, Is.GreaterThanOrEqualTo(commits.MeanDuration));
+        }
+
         [Test]
         public void Realm_HittingMaxNumberOfVersions_Throws()
         {
@@ -467,6 +467,86 @@ public void GetByPrimaryKeyDifferentThreads()
             });
         }
 
+        [Test]
+        public void FindObjects_ReturnsHandlesInArgumentOrderAndNullForMisses()
+        {
+            _realm.Write(() =>
+            {
+                _realm.Add(new PrimaryKeyStringObject { Id = "b" });
+                _realm.Add(new PrimaryKeyStringObject { Id = "a" });
+            });
+
+            var metadata = _realm.Metadata[nameof(PrimaryKeyStringObject)];
+            var handles = _realm.SharedRealmHandle.FindObjects(metadata.TableKey, new RealmValue[] { "b", "missing", "a", RealmValue.Null });
+
+            Assert.That(handles.Length, Is.EqualTo(4));
+            Assert.That(handles[0]!.GetValue("_id", metadata, _realm).AsString(), Is.EqualTo("b"));
+            Assert.That(handles[1], Is.Null);
+            Assert.That(handles[2]!.GetValue("_id", metadata, _realm).AsString(), Is.EqualTo("a"));
+            Assert.That(handles[3], Is.Null);
+        }
+
+        [Test]
+        public void UpsertObjects_CreatesMissingAndUpdatesExistingObjects()
+        {
+            _realm.Write(() =>
+            {
+                _realm.Add(new PrimaryKeyStringObject { Id = "existing", Value = "old" });
+            });
+
+            var metadata = _realm.Metadata[nameof(PrimaryKeyStringObject)];
+            var propertyIndex = metadata.GetPropertyIndex(nameof(PrimaryKeyStringObject.Value));
+
+            var isNew = _realm.Write(() => _realm.SharedRealmHandle.UpsertObjects(metadata.TableKey,
+                new RealmValue[] { "new", "existing" }, new[] { propertyIndex }, new RealmValue[] { "a", "b" }, columnar: false));
+
+            Assert.That(isNew, Is.EqualTo(new[] { true, false }));
+            Assert.That(_realm.Find<PrimaryKeyStringObject>("new")!.Value, Is.EqualTo("a"));
+            Assert.That(_realm.Find<PrimaryKeyStringObject>("existing")!.Value, Is.EqualTo("b"));
+        }
+
+        [Test]
+        public void BulkCreate_PopulatesPrimaryKeyAndValuesFromColumns()
+        {
+            var metadata = _realm.Metadata[nameof(IntPrimaryKeyWithValueObject)];
+            var columns = new (IntPtr, Array)[]
+            {
+                (metadata.GetPropertyIndex("_id"), new long[] { 1, 2, 3 }),
+                (metadata.GetPropertyIndex(nameof(IntPrimaryKeyWithValueObject.StringValue)), new string?[] { "one", null, "three" }),
+            };
+
+            _realm.Write(() => _realm.SharedRealmHandle.BulkCreate(metadata.TableKey, 3, columns));
+
+            Assert.That(_realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(3));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(1)!.StringValue, Is.EqualTo("one"));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(2)!.StringValue, Is.Null);
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(3)!.StringValue, Is.EqualTo("three"));
+        }
+
+        [Test]
+        public void BulkCreate_WhenPrimaryKeyExists_ThrowsAndKeepsExistingObject()
+        {
+            _realm.Write(() => _realm.Add(new IntPrimaryKeyWithValueObject { Id = 2, StringValue = "existing" }));
+
+            var metadata = _realm.Metadata[nameof(IntPrimaryKeyWithValueObject)];
+            var propertyIndices = new[] { metadata.GetPropertyIndex("_id"), metadata.GetPropertyIndex(nameof(IntPrimaryKeyWithValueObject.StringValue)) };
+
+            Assert.That(() => _realm.Write(() => _realm.SharedRealmHandle.BulkCreate(metadata.TableKey, 2, new (IntPtr, Array)[]
+            {
+                (propertyIndices[0], new long[] { 1, 2 }),
+                (propertyIndices[1], new string?[] { "one", "two" }),
+            })), Throws.TypeOf<RealmDuplicatePrimaryKeyValueException>());
+
+            Assert.That(() => _realm.Write(() => _realm.SharedRealmHandle.BulkCreate(metadata.TableKey, 2, new (IntPtr, Array)[]
+            {
+                (propertyIndices[0], new long[] { 5, 5 }),
+                (propertyIndices[1], new string?[] { "five", "another five" }),
+            })), Throws.TypeOf<RealmDuplicatePrimaryKeyValueException>());
+
+            Assert.That(_realm.All<IntPrimaryKeyWithValueObject>().Count(), Is.EqualTo(1));
+            Assert.That(_realm.Find<IntPrimaryKeyWithValueObject>(2)!.StringValue, Is.EqualTo("existing"));
+        }
+
         [Test]
         public void PrimaryKeyStringObjectIsUnique()
         {
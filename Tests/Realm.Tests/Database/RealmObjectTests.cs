@@ -214,6 +214,36 @@ public void RealmObjectEqualsCheck_WhenDeleted_ReturnsFalse()
             Assert.That(peter, Is.Not.EqualTo(george));
         }
 
+        [Test]
+        public void RealmObjectEqualsCheck_WhenDeletedAndPrimaryKeyReused_ReturnsFalse()
+        {
+            var original = _realm.Write(() => _realm.Add(new IntPrimaryKeyWithValueObject { Id = 1 }));
+
+            _realm.Write(() => _realm.Remove(original));
+            var recreated = _realm.Write(() => _realm.Add(new IntPrimaryKeyWithValueObject { Id = 1 }));
+
+            Assert.That(recreated, Is.Not.EqualTo(original));
+            Assert.That(original, Is.Not.EqualTo(recreated));
+        }
+
+        [Test]
+        public void RealmObject_WhenUsedInHashSet_MatchesObjectsForTheSameRow()
+        {
+            _realm.Write(() =>
+            {
+                for (var i = 0; i < 100; i++)
+                {
+                    _realm.Add(new IntPrimaryKeyWithValueObject { Id = i });
+                }
+            });
+
+            var set = new HashSet<IntPrimaryKeyWithValueObject>(_realm.All<IntPrimaryKeyWithValueObject>());
+
+            Assert.That(set.Count, Is.EqualTo(100));
+            Assert.That(set.Contains(_realm.Find<IntPrimaryKeyWithValueObject>(42)!));
+            Assert.That(set.Add(_realm.Find<IntPrimaryKeyWithValueObject>(7)!), Is.False);
+        }
+
         [Test]
         public void RealmObject_GetHashCode_ChangesAfterAddingToRealm()
         {
@@ -17,9 +17,12 @@
 ////////////////////////////////////////////////////////////////////////////
 
 using System;
+using System.Collections.Generic;
 using System.Linq;
 using System.Linq.Expressions;
 using NUnit.Framework;
+using Realms.Exceptions;
+using Realms.Native;
 
 namespace Realms.Tests.Database
 {
@@ -120,5 +123,206 @@ public void ProviderExecute_WhenNonGenericAndNoMatch_ReturnsNull()
 
             Assert.That(result, Is.Null);
         }
+
+        [Test]
+        public void Explain_ReportsRowCountsForEachStage()
+        {
+            MakeThreePeople();
+
+            var query = (RealmResults<Person>)_realm.All<Person>().Filter("IsInteresting == true SORT(Score DESC) LIMIT(1)");
+            var explanation = query.ResultsHandle.Explain();
+
+            Assert.That(explanation.TableSize, Is.EqualTo(3));
+            Assert.That(explanation.MatchedCount, Is.EqualTo(2));
+            Assert.That(explanation.ResultCount, Is.EqualTo(1));
+            Assert.That(explanation.QueryDuration, Is.GreaterThanOrEqualTo(TimeSpan.Zero));
+        }
+
+        [Test]
+        public void EvaluateParallel_MatchesSequentialEvaluationInKeyOrder()
+        {
+            _realm.Write(() =>
+            {
+                for (var i = 0; i < 20_000; i++)
+                {
+                    _realm.Add(new IntPrimaryKeyWithValueObject { Id = i, StringValue = $"Value {i}" });
+                }
+            });
+
+            using var frozenRealm = _realm.Freeze();
+            var query = (RealmResults<IntPrimaryKeyWithValueObject>)frozenRealm.All<IntPrimaryKeyWithValueObject>().Filter("Id >= 100 AND StringValue ENDSWITH '7'");
+            var expected = query.AsEnumerable().Select(o => o.Id).ToArray();
+
+            using var parallelResult = query.ResultsHandle.EvaluateParallel(maxThreads: 4);
+            Assert.That(parallelResult.Count(), Is.EqualTo(expected.Length));
+
+            var ids = parallelResult.GetObjects(0, expected.Length, frozenRealm).Select(v => v.As<IntPrimaryKeyWithValueObject>().Id);
+            Assert.That(ids, Is.EqualTo(expected));
+
+            var sorted = (RealmResults<IntPrimaryKeyWithValueObject>)query.OrderBy(o => o.Id);
+            Assert.That(() => sorted.ResultsHandle.EvaluateParallel(maxThreads: 4), Throws.InstanceOf<RealmException>());
+
+            var live = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>();
+            Assert.That(() => live.ResultsHandle.EvaluateParallel(maxThreads: 4), Throws.InstanceOf<RealmException>());
+        }
+
+        [Test]
+        public void EvaluateParallel_WhenResultsAreAFilteredList_Throws()
+        {
+            var owner = new Owner { Name = "Owner" };
+            _realm.Write(() =>
+            {
+                _realm.Add(new Dog { Name = "Stray" });
+                owner.ListOfDogs.Add(new Dog { Name = "Rex" });
+                owner.ListOfDogs.Add(new Dog { Name = "Fido" });
+                _realm.Add(owner);
+            });
+
+            using var frozenRealm = _realm.Freeze();
+            var frozenOwner = frozenRealm.All<Owner>().Single();
+
+            var filteredList = (RealmResults<Dog>)frozenOwner.ListOfDogs.Filter("Name != 'Fido'");
+            Assert.That(() => filteredList.ResultsHandle.EvaluateParallel(maxThreads: 4), Throws.InstanceOf<RealmException>());
+        }
+
+        [Test]
+        public void Cursor_WithoutSortClauses_PagesInKeyOrder()
+        {
+            AddValueObjects(25, i => $"Value {i}");
+
+            var query = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>().Filter("Id != 3");
+            var expected = query.AsEnumerable().Select(o => o.Id).ToArray();
+
+            using var cursor = query.ResultsHandle.CreateCursor(Array.Empty<CursorSortClause>());
+            var pages = ReadAllPages(cursor, pageSize: 10);
+
+            Assert.That(pages.Select(p => p.Length), Is.EqualTo(new[] { 10, 10, 4 }));
+            Assert.That(pages.SelectMany(p => p), Is.EqualTo(expected));
+        }
+
+        [Test]
+        public void Cursor_WithSortClauses_PagesInSortOrderAndBreaksTiesByKey()
+        {
+            AddValueObjects(30, i => $"Value {i % 3}");
+
+            var query = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>();
+
+            // Enumerable.OrderByDescending is stable, so ties stay in the key order of the unsorted results.
+            var expected = query.AsEnumerable().OrderByDescending(o => o.StringValue).Select(o => o.Id).ToArray();
+
+            var metadata = _realm.Metadata[nameof(IntPrimaryKeyWithValueObject)];
+            using var cursor = query.ResultsHandle.CreateCursor(new[] { new CursorSortClause(metadata.GetPropertyIndex(nameof(IntPrimaryKeyWithValueObject.StringValue)), isAscending: false) });
+            var pages = ReadAllPages(cursor, pageSize: 4);
+
+            Assert.That(pages.Count, Is.EqualTo(8));
+            Assert.That(pages.SelectMany(p => p), Is.EqualTo(expected));
+        }
+
+        [Test]
+        public void Cursor_WhenObjectsChangeBetweenPages_ResumesAfterLastReturnedObject()
+        {
+            AddValueObjects(12, i => $"Value {i % 3}");
+
+            var query = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>();
+            var metadata = _realm.Metadata[nameof(IntPrimaryKeyWithValueObject)];
+            using var cursor = query.ResultsHandle.CreateCursor(new[] { new CursorSortClause(metadata.GetPropertyIndex(nameof(IntPrimaryKeyWithValueObject.StringValue)), isAscending: true) });
+
+            var firstPage = cursor.NextPage(5, _realm).Select(v => v.As<IntPrimaryKeyWithValueObject>().Id).ToArray();
+            Assert.That(firstPage, Is.EqualTo(new[] { 0, 3, 6, 9, 1 }));
+
+            _realm.Write(() =>
+            {
+                // Sorts before the last returned object, so it isn't returned
+                _realm.Add(new IntPrimaryKeyWithValueObject { Id = 100, StringValue = "Value 0" });
+
+                // Sorts after it, so it is
+                _realm.Add(new IntPrimaryKeyWithValueObject { Id = 101, StringValue = "Value 3" });
+
+                _realm.Remove(_realm.Find<IntPrimaryKeyWithValueObject>(4)!);
+            });
+
+            var rest = ReadAllPages(cursor, pageSize: 5).SelectMany(p => p);
+            Assert.That(rest, Is.EqualTo(new[] { 7, 10, 2, 5, 8, 11, 101 }));
+        }
+
+        [Test]
+        public void Cursor_WhenExhausted_ReturnsEmptyPagesUntilReset()
+        {
+            AddValueObjects(3, i => $"Value {i}");
+
+            var query = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>();
+            using var cursor = query.ResultsHandle.CreateCursor(Array.Empty<CursorSortClause>());
+
+            Assert.That(cursor.NextPage(3, _realm).Length, Is.EqualTo(3));
+            Assert.That(cursor.NextPage(3, _realm), Is.Empty);
+            Assert.That(cursor.NextPage(3, _realm), Is.Empty);
+
+            cursor.Reset();
+            Assert.That(cursor.NextPage(3, _realm).Length, Is.EqualTo(3));
+        }
+
+        [Test]
+        public void Cursor_WhenResultsAreSortedDistinctOrLimited_Throws()
+        {
+            AddValueObjects(3, i => $"Value {i}");
+
+            var sorted = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>().OrderBy(o => o.Id);
+            Assert.That(() => sorted.ResultsHandle.CreateCursor(Array.Empty<CursorSortClause>()), Throws.InstanceOf<RealmException>());
+
+            var distinct = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>().Filter("TRUEPREDICATE DISTINCT(StringValue)");
+            Assert.That(() => distinct.ResultsHandle.CreateCursor(Array.Empty<CursorSortClause>()), Throws.InstanceOf<RealmException>());
+
+            var limited = (RealmResults<IntPrimaryKeyWithValueObject>)_realm.All<IntPrimaryKeyWithValueObject>().Filter("TRUEPREDICATE LIMIT(2)");
+            Assert.That(() => limited.ResultsHandle.CreateCursor(Array.Empty<CursorSortClause>()), Throws.InstanceOf<RealmException>());
+        }
+
+        [Test]
+        public void Cursor_WhenResultsAreACollectionOrFilteredCollection_Throws()
+        {
+            var owner = new Owner { Name = "Owner" };
+            _realm.Write(() =>
+            {
+                _realm.Add(new Dog { Name = "Stray" });
+                owner.ListOfDogs.Add(new Dog { Name = "Rex" });
+                owner.ListOfDogs.Add(new Dog { Name = "Fido" });
+                _realm.Add(owner);
+            });
+
+            var list = (RealmResults<Dog>)owner.ListOfDogs.AsRealmQueryable();
+            Assert.That(() => list.ResultsHandle.CreateCursor(Array.Empty<CursorSortClause>()), Throws.InstanceOf<RealmException>());
+
+            var filteredList = (RealmResults<Dog>)owner.ListOfDogs.Filter("Name != 'Fido'");
+            Assert.That(() => filteredList.ResultsHandle.CreateCursor(Array.Empty<CursorSortClause>()), Throws.InstanceOf<RealmException>());
+
+            var rex = owner.ListOfDogs[0];
+            var filteredBacklinks = (RealmResults<Owner>)rex.Owners.Filter("Name == 'Owner'");
+            Assert.That(() => filteredBacklinks.ResultsHandle.CreateCursor(Array.Empty<CursorSortClause>()), Throws.InstanceOf<RealmException>());
+        }
+
+        private void AddValueObjects(int count, Func<int, string> getValue)
+        {
+            _realm.Write(() =>
+            {
+                for (var i = 0; i < count; i++)
+                {
+                    _realm.Add(new IntPrimaryKeyWithValueObject { Id = i, StringValue = getValue(i) });
+                }
+            });
+        }
+
+        private List<int[]> ReadAllPages(ResultsCursorHandle cursor, int pageSize)
+        {
+            var pages = new List<int[]>();
+            while (true)
+            {
+                var page = cursor.NextPage(pageSize, _realm);
+                if (page.Length == 0)
+                {
+                    return pages;
+                }
+
+                pages.Add(page.Select(v => v.As<IntPrimaryKeyWithValueObject>().Id).ToArray());
+            }
+        }
     }
 }
@@ -22,6 +22,7 @@
 using System.Threading.Tasks;
 using NUnit.Framework;
 using Realms.Exceptions;
+using Realms.Extensions;
 
 namespace Realms.Tests.Database
 {
@@ -395,6 +396,62 @@ public void QueryReference_WhenSortAndFilterApplied_ShouldWork()
             });
         }
 
+        [Test]
+        public void ReferenceBatch_ResolvesObjectsAndCollectionsInOrder()
+        {
+            TestHelpers.RunAsyncTest(async () =>
+            {
+                var objects = Enumerable.Range(0, 100).Select(i => new IntPropertyObject { Int = i }).ToArray();
+                var owner = new Owner();
+                owner.ListOfDogs.Add(new Dog { Name = "1" });
+                owner.ListOfDogs.Add(new Dog { Name = "2" });
+
+                _realm.Write(() =>
+                {
+                    _realm.Add(objects);
+                    _realm.Add(owner);
+                });
+
+                var handles = objects.Select(o => (RealmHandle)o.GetObjectHandle()!).Append(((RealmList<Dog>)owner.ListOfDogs).Handle.Value).ToArray();
+                var types = objects.Select(_ => ThreadSafeReference.Type.Object).Append(ThreadSafeReference.Type.List).ToArray();
+                using var batch = ThreadSafeReferenceBatchHandle.Create(_realm.SharedRealmHandle, handles, types);
+
+                Assert.That(batch.Count, Is.EqualTo(101));
+
+                _realm.Write(() => _realm.Remove(objects[0]));
+
+                await Task.Run(() =>
+                {
+                    using var otherRealm = GetRealm(_realm.Config);
+                    var resolved = batch.Resolve(otherRealm.SharedRealmHandle);
+
+                    using var deletedHandle = new ObjectHandle(otherRealm.SharedRealmHandle, resolved[0]);
+                    Assert.That(deletedHandle.IsValid, Is.False);
+
+                    var metadata = otherRealm.Metadata[nameof(IntPropertyObject)];
+                    for (var i = 1; i < objects.Length; i++)
+                    {
+                        var obj = (IntPropertyObject)otherRealm.MakeObject(metadata, new ObjectHandle(otherRealm.SharedRealmHandle, resolved[i]));
+                        Assert.That(obj.Int, Is.EqualTo(i));
+                    }
+
+                    var list = new RealmList<Dog>(otherRealm, new ListHandle(otherRealm.SharedRealmHandle, resolved[100]), otherRealm.Metadata[nameof(Dog)]);
+                    Assert.That(list.Select(d => d.Name), Is.EqualTo(new[] { "1", "2" }));
+                });
+            });
+        }
+
+        [Test]
+        public void ReferenceBatch_WhenSourceRealmInTransaction_ShouldFail()
+        {
+            var obj = new IntPropertyObject { Int = 12 };
+            _realm.Write(() => _realm.Add(obj));
+
+            using var transaction = _realm.BeginWrite();
+            Assert.That(() => ThreadSafeReferenceBatchHandle.Create(_realm.SharedRealmHandle, new RealmHandle[] { obj.GetObjectHandle()! }, new[] { ThreadSafeReference.Type.Object }),
+                Throws.InstanceOf<RealmException>());
+        }
+
         private ThreadSafeReference.Query<IntPropertyObject> SetupQueryReference(Func<IQueryable<IntPropertyObject>, IQueryable<IntPropertyObject>> queryFunc)
         {
             _realm.Write(() =>
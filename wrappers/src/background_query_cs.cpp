@@ -0,0 +1,203 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm.hpp>
+#include <realm/object-store/results.hpp>
+
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+#include "worker_pool_cs.hpp"
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace realm::binding {
+
+enum class aggregate_type : uint8_t {
+    Min,
+    Max,
+    Sum,
+    Average,
+};
+
+// A query evaluated on the worker pool against a frozen copy of a Results. The Results is frozen on the calling
+// thread, which only imports the query, and the evaluation happens on the pool, after which the task at
+// `task_completion_source` is completed through s_handle_task_completion and the outcome can be read with value()
+// or release_results().
+class BackgroundQuery : public std::enable_shared_from_this<BackgroundQuery> {
+public:
+    using Evaluator = std::function<void(BackgroundQuery& background_query, Results& frozen_results)>;
+
+    BackgroundQuery(Results frozen_results, void* task_completion_source)
+        : m_frozen_results(std::move(frozen_results))
+        , m_task_completion_source(task_completion_source)
+    {
+    }
+
+    void start(Evaluator evaluate)
+    {
+        WorkerPool::shared().submit([self = shared_from_this(), evaluate = std::move(evaluate)]() {
+            NativeException::Marshallable nativeEx{ ErrorCodes::Error::OK };
+            try {
+                evaluate(*self, self->m_frozen_results);
+            }
+            catch (...) {
+                nativeEx = convert_exception().for_marshalling();
+            }
+
+            // Pool threads have no SynchronizationContext, so the managed side is responsible for not running
+            // continuations inline.
+            s_handle_task_completion(self->m_task_completion_source, /* invoke_async */ false, nativeEx);
+        });
+    }
+
+    // Only numeric and timestamp values are stored, as they don't point into the Realm file.
+    void set_value(Mixed value)
+    {
+        m_value = value;
+    }
+
+    Mixed value() const
+    {
+        return m_value;
+    }
+
+    void set_results(Results results)
+    {
+        m_results = std::make_unique<Results>(std::move(results));
+    }
+
+    Results* release_results()
+    {
+        return m_results.release();
+    }
+
+private:
+    Results m_frozen_results;
+    void* m_task_completion_source;
+
+    Mixed m_value;
+    std::unique_ptr<Results> m_results;
+};
+
+} // namespace realm::binding
+
+namespace {
+
+std::shared_ptr<BackgroundQuery>* start_background_query(Results& results, const SharedRealm& frozen_realm, void* task_completion_source, BackgroundQuery::Evaluator evaluate)
+{
+    results.get_realm()->verify_thread();
+    if (!frozen_realm->is_frozen()) {
+        throw InvalidArgument(ErrorCodes::InvalidArgument, "Background queries must be evaluated against a frozen Realm.");
+    }
+
+    auto query = std::make_shared<BackgroundQuery>(results.freeze(frozen_realm), task_completion_source);
+    query->start(std::move(evaluate));
+    return new std::shared_ptr<BackgroundQuery>(std::move(query));
+}
+
+} // anonymous namespace
+
+extern "C" {
+
+REALM_EXPORT std::shared_ptr<BackgroundQuery>* results_count_async(Results& results, const SharedRealm& frozen_realm, void* tcs_ptr, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return start_background_query(results, frozen_realm, tcs_ptr, [](BackgroundQuery& background_query, Results& frozen_results) {
+            background_query.set_value(Mixed(static_cast<int64_t>(frozen_results.size())));
+        });
+    });
+}
+
+// Evaluates the query and descriptors and completes with a frozen Results of the matched objects.
+REALM_EXPORT std::shared_ptr<BackgroundQuery>* results_snapshot_async(Results& results, const SharedRealm& frozen_realm, void* tcs_ptr, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return start_background_query(results, frozen_realm, tcs_ptr, [](BackgroundQuery& background_query, Results& frozen_results) {
+            background_query.set_results(frozen_results.snapshot());
+        });
+    });
+}
+
+// Completes with null if there are no values to aggregate, or for Min and Max if all of them are null.
+REALM_EXPORT std::shared_ptr<BackgroundQuery>* results_aggregate_async(Results& results, const SharedRealm& frozen_realm, size_t property_index, aggregate_type type, void* tcs_ptr, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        const Property& property = results.get_object_schema().persisted_properties.at(property_index);
+        if (is_collection(property.type) || (property.type & ~PropertyType::Flags) == PropertyType::Object) {
+            throw InvalidArgument(ErrorCodes::InvalidProperty, util::format("Cannot aggregate '%1' as it is not a primitive property.", property.name));
+        }
+
+        const ColKey column = property.column_key;
+        return start_background_query(results, frozen_realm, tcs_ptr, [column, type](BackgroundQuery& background_query, Results& frozen_results) {
+            std::optional<Mixed> value;
+            switch (type) {
+                case aggregate_type::Min:
+                    value = frozen_results.min(column);
+                    break;
+                case aggregate_type::Max:
+                    value = frozen_results.max(column);
+                    break;
+                case aggregate_type::Sum:
+                    value = frozen_results.sum(column);
+                    break;
+                case aggregate_type::Average:
+                    value = frozen_results.average(column);
+                    break;
+            }
+
+            background_query.set_value(value.value_or(Mixed()));
+        });
+    });
+}
+
+// Like query_create_results, but the Results is frozen and evaluated on the worker pool.
+REALM_EXPORT std::shared_ptr<BackgroundQuery>* query_create_results_async(Query& query, SharedRealm& realm, DescriptorOrdering& descriptor, const SharedRealm& frozen_realm, void* tcs_ptr, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        Results results(realm, query, descriptor);
+        return start_background_query(results, frozen_realm, tcs_ptr, [](BackgroundQuery& background_query, Results& frozen_results) {
+            background_query.set_results(frozen_results.snapshot());
+        });
+    });
+}
+
+REALM_EXPORT void background_query_destroy(std::shared_ptr<BackgroundQuery>* query)
+{
+    delete query;
+}
+
+// Only valid once the task of a count or aggregate has completed successfully.
+REALM_EXPORT void background_query_get_value(std::shared_ptr<BackgroundQuery>& query, realm_value_t* value, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        *value = to_capi(query->value());
+    });
+}
+
+// Only valid once the task of a snapshot or query has completed successfully, and only once.
+REALM_EXPORT Results* background_query_get_results(std::shared_ptr<BackgroundQuery>& query, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return query->release_results();
+    });
+}
+
+}   // extern "C"
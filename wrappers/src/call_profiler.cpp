@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include "call_profiler.hpp"
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace {
+
+struct call_profile_entry {
+    realm_string_t name;
+    uint64_t calls;
+    uint64_t sampled_calls;
+    uint64_t sampled_nanoseconds;
+    uint64_t max_nanoseconds;
+};
+
+} // anonymous namespace
+
+#if REALM_DOTNET_CALL_PROFILING
+
+namespace {
+
+struct ThreadCounters;
+
+// Registered call sites, the counters of live threads and the totals of threads that have exited.
+struct ProfileRegistry {
+    std::mutex mutex;
+    std::vector<const char*> call_sites;
+    std::vector<ThreadCounters*> threads;
+    std::vector<call_profile_entry> retired;
+
+    // Call sites registered past CallProfiler::c_max_call_sites have no counters.
+    size_t profiled_call_sites() const
+    {
+        return std::min(call_sites.size(), CallProfiler::c_max_call_sites);
+    }
+
+    static ProfileRegistry& get()
+    {
+        // Leaked, as threads may still exit and unregister during static destruction.
+        static ProfileRegistry* registry = new ProfileRegistry();
+        return *registry;
+    }
+};
+
+struct ThreadCounters {
+    std::array<CallProfiler::CallSiteCounters, CallProfiler::c_max_call_sites> call_sites;
+
+    ThreadCounters()
+    {
+        auto& registry = ProfileRegistry::get();
+        std::lock_guard lock(registry.mutex);
+        registry.threads.push_back(this);
+    }
+
+    ~ThreadCounters()
+    {
+        auto& registry = ProfileRegistry::get();
+        std::lock_guard lock(registry.mutex);
+        registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+
+        registry.retired.resize(registry.profiled_call_sites());
+        for (size_t i = 0; i < registry.retired.size(); ++i) {
+            merge(call_sites[i], registry.retired[i]);
+        }
+    }
+
+    static void merge(const CallProfiler::CallSiteCounters& counters, call_profile_entry& entry)
+    {
+        entry.calls += counters.calls.load(std::memory_order_relaxed);
+        entry.sampled_calls += counters.sampled_calls.load(std::memory_order_relaxed);
+        entry.sampled_nanoseconds += counters.sampled_nanoseconds.load(std::memory_order_relaxed);
+        entry.max_nanoseconds = std::max(entry.max_nanoseconds, counters.max_nanoseconds.load(std::memory_order_relaxed));
+    }
+};
+
+} // anonymous namespace
+
+namespace realm::binding {
+
+size_t CallProfiler::register_call_site(const char* name)
+{
+    auto& registry = ProfileRegistry::get();
+    std::lock_guard lock(registry.mutex);
+    registry.call_sites.push_back(name);
+    return registry.call_sites.size() - 1;
+}
+
+CallProfiler::CallSiteCounters* CallProfiler::counters_for(size_t call_site)
+{
+    if (call_site >= c_max_call_sites) {
+        return nullptr;
+    }
+
+    thread_local ThreadCounters counters;
+    return &counters.call_sites[call_site];
+}
+
+} // namespace realm::binding
+
+#endif // REALM_DOTNET_CALL_PROFILING
+
+extern "C" {
+
+// Copies up to `buffer_length` entries, one per function that was called at least once, and returns the total number
+// of entries so that the caller can retry with a larger buffer. Latencies are sums over the sampled calls only.
+// Always returns 0 unless the wrappers were built with REALM_DOTNET_CALL_PROFILING.
+REALM_EXPORT size_t realm_get_call_profile(call_profile_entry* buffer, size_t buffer_length, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() -> size_t {
+#if REALM_DOTNET_CALL_PROFILING
+        auto& registry = ProfileRegistry::get();
+        std::lock_guard lock(registry.mutex);
+
+        std::vector<call_profile_entry> entries(registry.retired);
+        entries.resize(registry.profiled_call_sites());
+        for (ThreadCounters* thread : registry.threads) {
+            for (size_t i = 0; i < entries.size(); ++i) {
+                ThreadCounters::merge(thread->call_sites[i], entries[i]);
+            }
+        }
+
+        size_t count = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (entries[i].calls == 0) {
+                continue;
+            }
+
+            if (count < buffer_length) {
+                buffer[count] = entries[i];
+                buffer[count].name = realm_string_t{ registry.call_sites[i], strlen(registry.call_sites[i]) };
+            }
+            ++count;
+        }
+
+        return count;
+#else
+        static_cast<void>(buffer);
+        static_cast<void>(buffer_length);
+        return 0;
+#endif
+    });
+}
+
+}   // extern "C"
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#if REALM_DOTNET_CALL_PROFILING
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace realm::binding {
+
+// Counts calls and samples the latency of every function wrapped in handle_errors. Only compiled in when the wrappers
+// are built with -DREALM_DOTNET_CALL_PROFILING=ON; otherwise handle_errors has no instrumentation at all.
+//
+// Only the outermost profiled call on a thread is recorded, so an export that calls helpers wrapped in handle_errors,
+// or that calls back into managed code which calls other exports, is counted once, including the time spent in them.
+//
+// Each thread records into its own counters, which are only ever written by that thread, so recording doesn't need
+// any synchronization beyond relaxed atomic stores. The counters of all threads are merged when a profile is requested.
+class CallProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // The call sites beyond this are not profiled.
+    static constexpr size_t c_max_call_sites = 1024;
+
+    // Every call is counted, but only the first and then every 16th call on a thread is timed.
+    static constexpr uint64_t c_sample_interval = 16;
+
+    struct CallSiteCounters {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> sampled_calls{0};
+        std::atomic<uint64_t> sampled_nanoseconds{0};
+        std::atomic<uint64_t> max_nanoseconds{0};
+    };
+
+    // Returns the index of the call site. `name` must have static storage duration.
+    static size_t register_call_site(const char* name);
+
+    // The counters of the current thread for the call site, or nullptr if there are too many call sites.
+    static CallSiteCounters* counters_for(size_t call_site);
+};
+
+class ProfiledCall {
+public:
+    explicit ProfiledCall(size_t call_site)
+        : m_counters(s_depth++ == 0 ? CallProfiler::counters_for(call_site) : nullptr)
+    {
+        if (!m_counters) {
+            return;
+        }
+
+        const uint64_t calls = m_counters->calls.load(std::memory_order_relaxed);
+        m_counters->calls.store(calls + 1, std::memory_order_relaxed);
+        if (calls % CallProfiler::c_sample_interval == 0) {
+            m_sampled = true;
+            m_started = CallProfiler::Clock::now();
+        }
+    }
+
+    ~ProfiledCall()
+    {
+        --s_depth;
+        if (!m_sampled) {
+            return;
+        }
+
+        const auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(CallProfiler::Clock::now() - m_started).count());
+        m_counters->sampled_calls.store(m_counters->sampled_calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        m_counters->sampled_nanoseconds.store(m_counters->sampled_nanoseconds.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+        if (elapsed > m_counters->max_nanoseconds.load(std::memory_order_relaxed)) {
+            m_counters->max_nanoseconds.store(elapsed, std::memory_order_relaxed);
+        }
+    }
+
+    ProfiledCall(const ProfiledCall&) = delete;
+    ProfiledCall& operator=(const ProfiledCall&) = delete;
+
+private:
+    // The number of profiled calls in progress on this thread.
+    static inline thread_local size_t s_depth = 0;
+
+    CallProfiler::CallSiteCounters* m_counters;
+    bool m_sampled = false;
+    CallProfiler::Clock::time_point m_started;
+};
+
+} // namespace realm::binding
+
+#endif // REALM_DOTNET_CALL_PROFILING
@@ -21,6 +21,7 @@
 #include <string>
 #include <new>
 #include <realm.hpp>
+#include "call_profiler.hpp"
 #include "realm_export_decls.hpp"
 
 namespace realm {
@@ -181,7 +182,7 @@ struct Default<void> {
 };
 
 template <class F>
-auto handle_errors(NativeException::Marshallable& ex, F&& func) -> decltype(func())
+auto invoke_marshalling_errors(NativeException::Marshallable& ex, F&& func) -> decltype(func())
 {
     using RetVal = decltype(func());
     ex.code = ErrorCodes::Error::OK;
@@ -194,4 +195,22 @@ auto handle_errors(NativeException::Marshallable& ex, F&& func) -> decltype(func
     }
 }
 
+#if REALM_DOTNET_CALL_PROFILING
+// Every call is counted against `function_name`, which defaults to the name of the calling export. Each export passes
+// its own lambda type, so the call site is registered once per export.
+template <class F>
+auto handle_errors(NativeException::Marshallable& ex, F&& func, const char* function_name = __builtin_FUNCTION()) -> decltype(func())
+{
+    static const size_t call_site = binding::CallProfiler::register_call_site(function_name);
+    binding::ProfiledCall profiled_call(call_site);
+    return invoke_marshalling_errors(ex, std::forward<F>(func));
+}
+#else
+template <class F>
+auto handle_errors(NativeException::Marshallable& ex, F&& func) -> decltype(func())
+{
+    return invoke_marshalling_errors(ex, std::forward<F>(func));
+}
+#endif
+
 } // namespace realm
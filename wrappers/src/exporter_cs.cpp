@@ -0,0 +1,340 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// #include json.hpp needs to be before #include realm.hpp due to https://github.com/nlohmann/json/issues/2129
+#include <external/json/json.hpp>
+
+#include <realm.hpp>
+#include <realm/util/base64.hpp>
+#include <realm/util/file.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/object-store/results.hpp>
+
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace {
+
+enum class export_format : uint8_t {
+    Columnar,
+    NDJSON,
+};
+
+// The columnar format is a sequence of record batches preceded by a schema, all little-endian:
+//
+//   header:  "RLMCOL01" | uint32 column count | per column: uint16 name length, UTF-8 name, uint8 realm_value_type, uint8 nullable
+//   batch:   uint32 row count (> 0) | per column: validity bitmap of (rows + 7) / 8 bytes (bit set = value present), values
+//   footer:  uint32 0
+//
+// Values are stored as int64 (int), uint8 (bool), float, double, int64 seconds and int32 nanoseconds since the Unix epoch
+// (dates, so that the full range of Timestamp is covered), 12 bytes (ObjectId), 16 bytes (Decimal128, UUID) or, for
+// strings and binary data, uint32 offsets[rows + 1] followed by the bytes.
+// Null values occupy their slot with zeroes, so every fixed-width column has exactly `rows` values.
+constexpr char c_columnar_magic[] = "RLMCOL01";
+
+class BatchWriter {
+public:
+    explicit BatchWriter(util::File& file)
+        : m_file(file)
+    {
+    }
+
+    template <typename T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    void write_bytes(const char* data, size_t size)
+    {
+        m_buffer.insert(m_buffer.end(), data, data + size);
+    }
+
+    void flush()
+    {
+        m_file.write(m_buffer.data(), m_buffer.size());
+        m_buffer.clear();
+    }
+
+private:
+    util::File& m_file;
+    std::vector<char> m_buffer;
+};
+
+bool is_exportable(const Property& property)
+{
+    const auto type = property.type & ~PropertyType::Flags;
+    return !is_collection(property.type) && type != PropertyType::Object && type != PropertyType::LinkingObjects;
+}
+
+class ResultsExporter {
+public:
+    ResultsExporter(Results& results, std::vector<const Property*> properties, size_t batch_size)
+        : m_results(results)
+        , m_properties(std::move(properties))
+        , m_batch_size(std::max<size_t>(batch_size, 1))
+    {
+    }
+
+    uint64_t write_columnar(util::File& file)
+    {
+        BatchWriter writer(file);
+        writer.write_bytes(c_columnar_magic, sizeof(c_columnar_magic) - 1);
+        writer.write(static_cast<uint32_t>(m_properties.size()));
+        for (const Property* property : m_properties) {
+            writer.write(static_cast<uint16_t>(property->name.size()));
+            writer.write_bytes(property->name.data(), property->name.size());
+            writer.write(to_capi(property->type));
+            writer.write(static_cast<uint8_t>(is_nullable(property->type)));
+        }
+        writer.flush();
+
+        const size_t size = m_results.size();
+        std::vector<Obj> batch;
+        batch.reserve(std::min(m_batch_size, size));
+
+        for (size_t start = 0; start < size; start += m_batch_size) {
+            batch.clear();
+            for (size_t i = start; i < std::min(start + m_batch_size, size); ++i) {
+                batch.push_back(m_results.get(i));
+            }
+
+            writer.write(static_cast<uint32_t>(batch.size()));
+            for (const Property* property : m_properties) {
+                write_column(writer, *property, batch);
+            }
+            writer.flush();
+        }
+
+        writer.write(uint32_t(0));
+        writer.flush();
+        return size;
+    }
+
+    uint64_t write_ndjson(util::File& file)
+    {
+        const size_t size = m_results.size();
+        std::string buffer;
+
+        for (size_t i = 0; i < size; ++i) {
+            const Obj obj = m_results.get(i);
+            nlohmann::json json = nlohmann::json::object();
+            for (const Property* property : m_properties) {
+                json[property->name] = to_json(obj.get_any(property->column_key));
+            }
+
+            buffer += json.dump();
+            buffer += '\n';
+
+            if ((i + 1) % m_batch_size == 0 || i + 1 == size) {
+                file.write(buffer.data(), buffer.size());
+                buffer.clear();
+            }
+        }
+
+        return size;
+    }
+
+private:
+    Results& m_results;
+    std::vector<const Property*> m_properties;
+    size_t m_batch_size;
+
+    void write_column(BatchWriter& writer, const Property& property, const std::vector<Obj>& batch)
+    {
+        std::vector<Mixed> values;
+        values.reserve(batch.size());
+        for (const Obj& obj : batch) {
+            values.push_back(obj.get_any(property.column_key));
+        }
+
+        std::vector<uint8_t> validity((values.size() + 7) / 8);
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (!values[i].is_null()) {
+                validity[i / 8] |= 1 << (i % 8);
+            }
+        }
+        writer.write_bytes(reinterpret_cast<const char*>(validity.data()), validity.size());
+
+        switch (property.type & ~PropertyType::Flags) {
+            case PropertyType::Int:
+                for (const Mixed& value : values) {
+                    writer.write(value.is_null() ? int64_t(0) : value.get_int());
+                }
+                break;
+            case PropertyType::Bool:
+                for (const Mixed& value : values) {
+                    writer.write(static_cast<uint8_t>(!value.is_null() && value.get_bool()));
+                }
+                break;
+            case PropertyType::Float:
+                for (const Mixed& value : values) {
+                    writer.write(value.is_null() ? 0.0f : value.get_float());
+                }
+                break;
+            case PropertyType::Double:
+                for (const Mixed& value : values) {
+                    writer.write(value.is_null() ? 0.0 : value.get_double());
+                }
+                break;
+            case PropertyType::Date:
+                for (const Mixed& value : values) {
+                    writer.write(value.is_null() ? int64_t(0) : value.get_timestamp().get_seconds());
+                    writer.write(value.is_null() ? int32_t(0) : value.get_timestamp().get_nanoseconds());
+                }
+                break;
+            case PropertyType::ObjectId:
+                for (const Mixed& value : values) {
+                    writer.write(value.is_null() ? ObjectId::ObjectIdBytes{} : value.get_object_id().to_bytes());
+                }
+                break;
+            case PropertyType::UUID:
+                for (const Mixed& value : values) {
+                    writer.write(value.is_null() ? UUID::UUIDBytes{} : value.get_uuid().to_bytes());
+                }
+                break;
+            case PropertyType::Decimal:
+                for (const Mixed& value : values) {
+                    writer.write(value.is_null() ? Decimal128::Bid128{} : *value.get_decimal().raw());
+                }
+                break;
+            case PropertyType::String:
+            case PropertyType::Data: {
+                uint32_t offset = 0;
+                writer.write(offset);
+                for (const Mixed& value : values) {
+                    if (!value.is_null()) {
+                        offset += static_cast<uint32_t>(value.is_type(type_String) ? value.get_string().size() : value.get_binary().size());
+                    }
+                    writer.write(offset);
+                }
+                for (const Mixed& value : values) {
+                    if (value.is_null()) {
+                        continue;
+                    }
+                    if (value.is_type(type_String)) {
+                        writer.write_bytes(value.get_string().data(), value.get_string().size());
+                    }
+                    else {
+                        writer.write_bytes(value.get_binary().data(), value.get_binary().size());
+                    }
+                }
+                break;
+            }
+            default:
+                REALM_UNREACHABLE();
+        }
+    }
+
+    // Dates are written as milliseconds since the Unix epoch, binary data as base64 and other values without a JSON
+    // representation as strings, matching what shared_realm_import_file accepts.
+    static nlohmann::json to_json(const Mixed& value)
+    {
+        if (value.is_null()) {
+            return nullptr;
+        }
+
+        switch (value.get_type()) {
+            case type_Int:
+                return value.get_int();
+            case type_Bool:
+                return value.get_bool();
+            case type_Float:
+                return value.get_float();
+            case type_Double:
+                return value.get_double();
+            case type_String:
+                return std::string(value.get_string());
+            case type_Binary: {
+                const BinaryData binary = value.get_binary();
+                std::string encoded(util::base64_encoded_size(binary.size()), '\0');
+                encoded.resize(util::base64_encode({binary.data(), binary.size()}, {encoded.data(), encoded.size()}));
+                return encoded;
+            }
+            case type_Timestamp: {
+                const Timestamp timestamp = value.get_timestamp();
+                return timestamp.get_seconds() * 1000 + timestamp.get_nanoseconds() / 1'000'000;
+            }
+            case type_ObjectId:
+                return value.get_object_id().to_string();
+            case type_UUID:
+                return value.get_uuid().to_string();
+            case type_Decimal:
+                return value.get_decimal().to_string();
+            default:
+                return nullptr;
+        }
+    }
+};
+
+} // anonymous namespace
+
+extern "C" {
+
+// Writes the objects in `results` to the file at `path_buf`, either in the columnar format described above or as
+// newline-delimited JSON. Only the properties at `property_indices` are exported or, if none are passed, all
+// properties that aren't links or collections. The objects are read from a frozen copy of the results, so the
+// export reflects a single version and doesn't hold up writers. Returns the number of exported objects.
+REALM_EXPORT uint64_t results_export(Results& results, size_t* property_indices, size_t properties_count, uint16_t* path_buf, size_t path_len,
+    export_format format, size_t batch_size, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() -> uint64_t {
+        const SharedRealm& realm = results.get_realm();
+        realm->verify_thread();
+
+        const ObjectSchema& object_schema = results.get_object_schema();
+        std::vector<const Property*> properties;
+        if (properties_count == 0) {
+            for (const Property& property : object_schema.persisted_properties) {
+                if (is_exportable(property) && (format == export_format::NDJSON || (property.type & ~PropertyType::Flags) != PropertyType::Mixed)) {
+                    properties.push_back(&property);
+                }
+            }
+        }
+        else {
+            properties.reserve(properties_count);
+            for (size_t i = 0; i < properties_count; ++i) {
+                const Property& property = object_schema.persisted_properties.at(property_indices[i]);
+                if (!is_exportable(property) || (format == export_format::Columnar && (property.type & ~PropertyType::Flags) == PropertyType::Mixed)) {
+                    throw InvalidArgument(ErrorCodes::InvalidProperty, util::format("Property '%1.%2' of type %3 can't be exported.", object_schema.name, property.name, to_string(property.type)));
+                }
+                properties.push_back(&property);
+            }
+        }
+
+        // The frozen Realm may be the coordinator's cached instance that the app is also using, so it isn't closed.
+        // Releasing our reference when we're done is what unpins the version.
+        auto frozen_realm = realm->is_frozen() ? realm : realm->freeze();
+        Results frozen_results = realm->is_frozen() ? results : results.freeze(frozen_realm);
+
+        Utf16StringAccessor path(path_buf, path_len);
+        util::File file(path.to_string(), util::File::mode_Write);
+
+        ResultsExporter exporter(frozen_results, std::move(properties), batch_size);
+        return format == export_format::Columnar ? exporter.write_columnar(file) : exporter.write_ndjson(file);
+    });
+}
+
+}   // extern "C"
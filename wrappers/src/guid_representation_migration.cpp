@@ -22,10 +22,21 @@
 #include <realm/list.hpp>
 #include <realm/set.hpp>
 #include <realm/dictionary.hpp>
+#include <realm/object-store/util/scheduler.hpp>
 
 #include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 using namespace realm;
+using namespace realm::binding;
 
 // Microsoft's GUID layout, matching how System.Guid is represented
 struct RealmGUID {
@@ -52,102 +63,383 @@ private:
     }
 };
 
-static bool flip_guid(Mixed& mixed, bool& found_non_v4_uuid) {
-    if (!mixed.is_null() && mixed.get_type() == type_UUID) {
-        UUID::UUIDBytes bytes = mixed.get_uuid().to_bytes();
-
-        // try to detect if this is a Microsoft GUID or a UUID
-        // We do this by checking the version (see https://en.wikipedia.org/wiki/Universally_unique_identifier#Format).
-        // If the first four bits of the 7th byte in the array are equal to 4, then this is a valid UUID of version 4 (random-generated UUID).
-        // A Microsoft GUID on the other hand will have the version in the 8th byte, because the Data3 field is encoded in a big-endian format.
-        // We can assume that if the 4th byte doesn't carry the version 4 bits, but the 8th one does then this is a Microsoft GUID
-        // created with Guid.NewGuid(). Manual testing shows that Guid.NewGuid() has only about ~6% probability of generating a GUID where
-        // both the 7th and 8th bits match the bit pattern, so a realm file created with the .NET SDK should hold a majority
-        // of GUID values where only the 8th byte matches the version 4 bit pattern.
-        found_non_v4_uuid |= (bytes[6] >> 4) != 4 && (bytes[7] >> 4) == 4;
-
-        RealmGUID& guid = *reinterpret_cast<RealmGUID*>(bytes.data());
-        guid.swap_endianness();
-        mixed = Mixed(UUID(std::move(bytes)));
-        return true;
-    }
-    return false;
+static bool is_legacy_guid(const UUID::UUIDBytes& bytes)
+{
+    // try to detect if this is a Microsoft GUID or a UUID
+    // We do this by checking the version (see https://en.wikipedia.org/wiki/Universally_unique_identifier#Format).
+    // If the first four bits of the 7th byte in the array are equal to 4, then this is a valid UUID of version 4 (random-generated UUID).
+    // A Microsoft GUID on the other hand will have the version in the 8th byte, because the Data3 field is encoded in a big-endian format.
+    // We can assume that if the 4th byte doesn't carry the version 4 bits, but the 8th one does then this is a Microsoft GUID
+    // created with Guid.NewGuid(). Manual testing shows that Guid.NewGuid() has only about ~6% probability of generating a GUID where
+    // both the 7th and 8th bits match the bit pattern, so a realm file created with the .NET SDK should hold a majority
+    // of GUID values where only the 8th byte matches the version 4 bit pattern.
+    return (bytes[6] >> 4) != 4 && (bytes[7] >> 4) == 4;
 }
 
-static bool byteswap_guids(TableRef table, bool& found_non_v4_uuid)
-{
-    bool has_uuid_column = false;
+// The columns of a table that may hold Guid values.
+struct GuidColumns {
     std::vector<ColKey> primitive_columns;
     std::vector<ColKey> list_columns;
     std::vector<ColKey> set_columns;
     std::vector<ColKey> dictionary_columns;
-    table->for_each_public_column([&](ColKey col) {
-        if (col.get_type() == col_type_UUID || col.get_type() == col_type_Mixed) {
-            has_uuid_column = true;
-
-            if (col.is_list()) {
-                list_columns.push_back(col);
-            } else if (col.is_set()) {
-                set_columns.push_back(col);
-            } else if (col.is_dictionary()) {
-                dictionary_columns.push_back(col);
-            } else {
-                REALM_ASSERT(!col.is_collection());
-                primitive_columns.push_back(col);
+
+    explicit GuidColumns(const TableRef& table)
+    {
+        table->for_each_public_column([&](ColKey col) {
+            if (col.get_type() == col_type_UUID || col.get_type() == col_type_Mixed) {
+                if (col.is_list()) {
+                    list_columns.push_back(col);
+                } else if (col.is_set()) {
+                    set_columns.push_back(col);
+                } else if (col.is_dictionary()) {
+                    dictionary_columns.push_back(col);
+                } else {
+                    REALM_ASSERT(!col.is_collection());
+                    primitive_columns.push_back(col);
+                }
             }
-        }
-        return IteratorControl::AdvanceToNext; // keep iterating
-    });
+            return IteratorControl::AdvanceToNext; // keep iterating
+        });
+    }
 
-    if (!has_uuid_column)
+    bool empty() const
     {
-        return false;
+        return primitive_columns.empty() && list_columns.empty() && set_columns.empty() && dictionary_columns.empty();
     }
+};
 
-    for (Obj& obj : *table) {
-        for (auto col : primitive_columns) {
-            Mixed m = obj.get_any(col);
-            if (flip_guid(m, found_non_v4_uuid)) {
-                obj.set_any(col, m);
+// The non-empty tables with columns that may hold Guid values.
+static std::vector<std::pair<TableKey, GuidColumns>> find_guid_tables(Group& group)
+{
+    std::vector<std::pair<TableKey, GuidColumns>> result;
+    for (TableKey key : group.get_table_keys()) {
+        if (group.table_is_public(key)) {
+            TableRef table = group.get_table(key);
+            GuidColumns columns(table);
+            if (!columns.empty() && table->size() > 0) {
+                result.emplace_back(key, std::move(columns));
             }
         }
-        for (auto col : list_columns) {
+    }
+
+    return result;
+}
+
+// A Guid value found by the scan, to be byte-swapped in the write transaction.
+struct GuidUpdate {
+    enum class Location : uint8_t { Property, ListElement, SetElement, DictionaryValue };
+
+    Location location;
+    TableKey table_key;
+    ObjKey obj_key;
+    ColKey col_key;
+    size_t list_index;
+    std::string dictionary_key;
+    UUID value;
+};
+
+// A range of objects in a table, by index.
+struct GuidScanChunk {
+    size_t table_index;
+    size_t begin;
+    size_t end;
+};
+
+static constexpr size_t c_objects_per_chunk = 16 * 1024;
+
+// Visits every Guid value in the chunk. `visit` returns false to stop the scan.
+template <typename Visitor>
+static bool visit_guids(Group& group, TableKey table_key, const GuidColumns& columns, const GuidScanChunk& chunk, Visitor&& visit)
+{
+    using Location = GuidUpdate::Location;
+
+    TableRef table = group.get_table(table_key);
+    for (size_t i = chunk.begin; i < chunk.end; ++i) {
+        Obj obj = table->get_object(i);
+        for (auto col : columns.primitive_columns) {
+            const Mixed value = obj.get_any(col);
+            if (value.is_type(type_UUID) && !visit(GuidUpdate{ Location::Property, table_key, obj.get_key(), col, 0, {}, value.get_uuid() })) {
+                return false;
+            }
+        }
+        for (auto col : columns.list_columns) {
             auto list = obj.get_listbase_ptr(col);
-            for (size_t i = 0; i < list->size(); i++) {
-                Mixed value = list->get_any(i);
-                if (flip_guid(value, found_non_v4_uuid)) {
-                    list->set_any(i, value);
+            for (size_t j = 0; j < list->size(); j++) {
+                const Mixed value = list->get_any(j);
+                if (value.is_type(type_UUID) && !visit(GuidUpdate{ Location::ListElement, table_key, obj.get_key(), col, j, {}, value.get_uuid() })) {
+                    return false;
                 }
             }
         }
-        for (auto col : set_columns) {
+        for (auto col : columns.set_columns) {
             auto set = obj.get_setbase_ptr(col);
-            std::vector<Mixed> values(set->size());
-            for (size_t i = 0; i < set->size(); i++) {
-                Mixed value = set->get_any(i);
-                flip_guid(value, found_non_v4_uuid);
-                values[i] = std::move(value);
-            }
-            set->clear();
-            for (auto& value : values) {
-                set->insert_any(std::move(value));
+            for (size_t j = 0; j < set->size(); j++) {
+                const Mixed value = set->get_any(j);
+                if (value.is_type(type_UUID) && !visit(GuidUpdate{ Location::SetElement, table_key, obj.get_key(), col, 0, {}, value.get_uuid() })) {
+                    return false;
+                }
             }
         }
-        for (auto col : dictionary_columns) {
+        for (auto col : columns.dictionary_columns) {
             auto dict = obj.get_dictionary_ptr(col);
-            std::map<Mixed, Mixed> values;
             for (auto pair : *dict) {
-                flip_guid(pair.second, found_non_v4_uuid);
-                values.emplace(pair.first, pair.second);
+                if (pair.second.is_type(type_UUID) && !visit(GuidUpdate{ Location::DictionaryValue, table_key, obj.get_key(), col, 0, std::string(pair.first.get_string()), pair.second.get_uuid() })) {
+                    return false;
+                }
             }
-            dict->clear();
-            for (auto pair : values) {
-                dict->insert(pair.first, pair.second);
+        }
+    }
+
+    return true;
+}
+
+// Scans the Guid tables in chunks of objects. Unless `realm` is in a write transaction, which can't be frozen, files
+// with more than one chunk are scanned in parallel. Each worker reads from its own uncached frozen Realm at the version
+// of `realm`, as freeze() would return the same cached instance to every worker.
+//
+// The Guids of a chunk are passed to the calling thread in chunk order, and the workers don't get more than
+// c_chunks_in_flight_per_worker chunks ahead of it, so the Guids held in memory are bounded regardless of the file size.
+class GuidScanner {
+public:
+    GuidScanner(SharedRealm& realm, const std::vector<std::pair<TableKey, GuidColumns>>& guid_tables, const GuidFixProgressT& progress)
+        : m_realm(realm)
+        , m_guid_tables(guid_tables)
+        , m_progress(progress)
+    {
+        for (size_t i = 0; i < guid_tables.size(); ++i) {
+            const size_t size = realm->read_group().get_table(guid_tables[i].first)->size();
+            for (size_t begin = 0; begin < size; begin += c_objects_per_chunk) {
+                m_chunks.push_back({ i, begin, std::min(begin + c_objects_per_chunk, size) });
+            }
+            m_total_objects += size;
+        }
+
+        const size_t worker_count = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), m_chunks.size());
+        if (worker_count > 1 && !realm->is_in_transaction()) {
+            const VersionID version = realm->read_transaction_version();
+            Realm::Config config = realm->config();
+            config.cache = false;
+            config.scheduler = util::Scheduler::make_frozen(version);
+            for (size_t i = 0; i < worker_count; ++i) {
+                m_worker_realms.push_back(Realm::get_frozen_realm(config, version));
             }
         }
     }
 
-    return table->size() > 0;
+    bool contains_legacy_guids()
+    {
+        std::atomic<bool> found{ false };
+        run([&](Group& group, const GuidScanChunk& chunk, std::vector<GuidUpdate>&) {
+            visit_guids(group, m_guid_tables[chunk.table_index].first, m_guid_tables[chunk.table_index].second, chunk, [&](const GuidUpdate& update) {
+                if (is_legacy_guid(update.value.to_bytes())) {
+                    found = true;
+                }
+                return !found.load(std::memory_order_relaxed);
+            });
+            return !found.load(std::memory_order_relaxed);
+        }, [](std::vector<GuidUpdate>&) {});
+
+        return found;
+    }
+
+    // Passes the Guids of each chunk to `consume` on the calling thread, in chunk order.
+    template <typename Consume>
+    void collect_guids(Consume&& consume)
+    {
+        run([&](Group& group, const GuidScanChunk& chunk, std::vector<GuidUpdate>& updates) {
+            visit_guids(group, m_guid_tables[chunk.table_index].first, m_guid_tables[chunk.table_index].second, chunk, [&](GuidUpdate&& update) {
+                updates.push_back(std::move(update));
+                return true;
+            });
+            return true;
+        }, consume);
+    }
+
+private:
+    static constexpr size_t c_chunks_in_flight_per_worker = 2;
+
+    SharedRealm& m_realm;
+    const std::vector<std::pair<TableKey, GuidColumns>>& m_guid_tables;
+    const GuidFixProgressT& m_progress;
+
+    std::vector<GuidScanChunk> m_chunks;
+    std::vector<SharedRealm> m_worker_realms;
+    uint64_t m_total_objects = 0;
+
+    // Runs `scan_chunk` for every chunk and passes the updates it collected to `consume_chunk` on the calling thread,
+    // in chunk order. `scan_chunk` returns false to stop the scan early.
+    template <typename ScanChunk, typename ConsumeChunk>
+    void run(ScanChunk&& scan_chunk, ConsumeChunk&& consume_chunk)
+    {
+        if (m_worker_realms.empty()) {
+            // Small files are scanned on the calling thread, reporting progress between chunks.
+            uint64_t processed_objects = 0;
+            for (const auto& chunk : m_chunks) {
+                std::vector<GuidUpdate> updates;
+                const bool keep_going = scan_chunk(m_realm->read_group(), chunk, updates);
+                consume_chunk(updates);
+                processed_objects += chunk.end - chunk.begin;
+                report_progress(processed_objects);
+                if (!keep_going) {
+                    break;
+                }
+            }
+            return;
+        }
+
+        const size_t max_chunks_in_flight = m_worker_realms.size() * c_chunks_in_flight_per_worker;
+
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::vector<std::optional<std::vector<GuidUpdate>>> scanned(m_chunks.size());
+        size_t next_chunk = 0;
+        size_t consumed_chunks = 0;
+        uint64_t processed_objects = 0;
+        bool stopped = false;
+        std::exception_ptr error;
+
+        auto stop = [&](std::exception_ptr stop_error) {
+            std::lock_guard lock(mutex);
+            stopped = true;
+            error = error ? error : stop_error;
+            changed.notify_all();
+        };
+
+        std::vector<std::thread> workers;
+        for (auto& worker_realm : m_worker_realms) {
+            workers.emplace_back([&, worker_realm] {
+                try {
+                    while (true) {
+                        size_t i;
+                        {
+                            std::unique_lock lock(mutex);
+                            changed.wait(lock, [&] { return stopped || next_chunk == m_chunks.size() || next_chunk < consumed_chunks + max_chunks_in_flight; });
+                            if (stopped || next_chunk == m_chunks.size()) {
+                                return;
+                            }
+                            i = next_chunk++;
+                        }
+
+                        std::vector<GuidUpdate> updates;
+                        const bool keep_going = scan_chunk(worker_realm->read_group(), m_chunks[i], updates);
+
+                        std::lock_guard lock(mutex);
+                        scanned[i] = std::move(updates);
+                        processed_objects += m_chunks[i].end - m_chunks[i].begin;
+                        stopped = stopped || !keep_going;
+                        changed.notify_all();
+                    }
+                }
+                catch (...) {
+                    stop(std::current_exception());
+                }
+            });
+        }
+
+        // The workers can't call into managed code, so the chunks are consumed and progress is reported from this thread.
+        try {
+            for (size_t i = 0; i < m_chunks.size(); ++i) {
+                std::unique_lock lock(mutex);
+                while (!changed.wait_for(lock, std::chrono::milliseconds(100), [&] { return stopped || scanned[i].has_value(); })) {
+                    const uint64_t processed = processed_objects;
+                    lock.unlock();
+                    report_progress(processed);
+                    lock.lock();
+                }
+
+                if (!scanned[i]) {
+                    break;
+                }
+
+                std::vector<GuidUpdate> updates = std::move(*scanned[i]);
+                scanned[i].reset();
+                lock.unlock();
+
+                consume_chunk(updates);
+
+                lock.lock();
+                ++consumed_chunks;
+                changed.notify_all();
+            }
+        }
+        catch (...) {
+            stop(std::current_exception());
+        }
+
+        // Stops workers that are waiting for the calling thread to catch up after the scan was stopped early.
+        stop(nullptr);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        report_progress(processed_objects);
+    }
+
+    void report_progress(uint64_t processed_objects)
+    {
+        if (m_progress && !m_progress(processed_objects, m_total_objects)) {
+            throw Exception(ErrorCodes::OperationAborted, "The Guid representation migration was cancelled.");
+        }
+    }
+};
+
+static UUID flip_guid(const UUID& value)
+{
+    UUID::UUIDBytes bytes = value.to_bytes();
+    reinterpret_cast<RealmGUID*>(bytes.data())->swap_endianness();
+    return UUID(bytes);
+}
+
+static void apply_guid_updates(Group& group, const std::vector<GuidUpdate>& updates)
+{
+    using Location = GuidUpdate::Location;
+
+    // Set elements are swapped in place rather than by clearing and refilling the set, but all of an object's old
+    // values are removed before the new ones are inserted, in case a swapped value equals another one in the set.
+    std::vector<const GuidUpdate*> set_updates;
+    auto flush_set_updates = [&]() {
+        if (set_updates.empty()) {
+            return;
+        }
+
+        const GuidUpdate& first = *set_updates.front();
+        auto set = group.get_table(first.table_key)->get_object(first.obj_key).get_setbase_ptr(first.col_key);
+        for (const GuidUpdate* update : set_updates) {
+            set->erase_any(Mixed(update->value));
+        }
+        for (const GuidUpdate* update : set_updates) {
+            set->insert_any(Mixed(flip_guid(update->value)));
+        }
+        set_updates.clear();
+    };
+
+    for (const auto& update : updates) {
+        if (!set_updates.empty() && (update.location != Location::SetElement || update.table_key != set_updates.front()->table_key ||
+                                     update.obj_key != set_updates.front()->obj_key || update.col_key != set_updates.front()->col_key)) {
+            flush_set_updates();
+        }
+
+        const Mixed value(flip_guid(update.value));
+        switch (update.location) {
+            case Location::Property:
+                group.get_table(update.table_key)->get_object(update.obj_key).set_any(update.col_key, value);
+                break;
+            case Location::ListElement:
+                group.get_table(update.table_key)->get_object(update.obj_key).get_listbase_ptr(update.col_key)->set_any(update.list_index, value);
+                break;
+            case Location::SetElement:
+                set_updates.push_back(&update);
+                break;
+            case Location::DictionaryValue:
+                group.get_table(update.table_key)->get_object(update.obj_key).get_dictionary_ptr(update.col_key)->insert(StringData(update.dictionary_key), value);
+                break;
+        }
+    }
+    flush_set_updates();
 }
 
 // marker table to say that this file has been processed already and can be skipped.
@@ -159,43 +451,48 @@ bool requires_guid_representation_fix(SharedRealm& realm)
     return !realm->read_group().has_table(c_guid_fix_table);
 }
 
-void apply_guid_representation_fix(SharedRealm& realm, bool& found_non_v4_uuid, bool& found_guid_columns)
+void apply_guid_representation_fix(SharedRealm& realm, bool& found_non_v4_uuid, bool& found_guid_columns, const GuidFixProgressT& progress)
 {
+    // Scan for legacy Guid values outside of the write transaction, only visiting the tables that can hold Guids. Most files
+    // don't need their values swapped, so the scan stops at the first legacy value. If there is one, the Guids are collected
+    // and swapped chunk by chunk in the write transaction, which only writes the swapped values and keeps a bounded number
+    // of them in memory at a time.
+    const auto read_version = realm->current_transaction_version();
+    auto guid_tables = find_guid_tables(realm->read_group());
+    auto scanner = std::make_unique<GuidScanner>(realm, guid_tables, progress);
+    found_non_v4_uuid = scanner->contains_legacy_guids();
+
     realm->begin_transaction();
-    auto* group = &realm->read_group();
+    auto& group = realm->read_group();
 
     // Check if someone has added the marker table before us - if that's the case, we should return
     // rather than do the work to swap guids.
-    if (group->has_table(c_guid_fix_table)) {
+    if (group.has_table(c_guid_fix_table)) {
         realm->cancel_transaction();
         return;
     }
 
-    for (TableKey key : group->get_table_keys()) {
-        if (group->table_is_public(key)) {
-            found_guid_columns |= byteswap_guids(group->get_table(key), found_non_v4_uuid);
-        }
+    // Beginning the write transaction advanced the Realm, so if another thread or process wrote in the
+    // meantime, what we found may be outdated and the scan is redone inside the write transaction.
+    if (realm->current_transaction_version() != read_version) {
+        scanner.reset();
+        guid_tables = find_guid_tables(group);
+        scanner = std::make_unique<GuidScanner>(realm, guid_tables, progress);
+        found_non_v4_uuid = scanner->contains_legacy_guids();
     }
 
-    if (!found_non_v4_uuid) {
-        // we didn't find any Microsoft GUID (see comment in flip_guid())
-        // so this is likely a realm file that wasn't created with the .NET SDK
-        // or doesn't have big-endian GUID values anyway
-        // let's cancel the current transaction and start a new one just to record the marker table
-        realm->cancel_transaction();
-        realm->begin_transaction();
-        group = &realm->read_group();
+    found_guid_columns = !guid_tables.empty();
 
-        // Re-check for the marker table as we exited a write transaction, so another thread
-        // might have added the table before re-acquiring the write lock.
-        if (group->has_table(c_guid_fix_table)) {
-            realm->cancel_transaction();
-            return;
-        }
+    // If we didn't find any Microsoft GUID (see comment in is_legacy_guid()), this is likely a realm file
+    // that wasn't created with the .NET SDK or doesn't have big-endian GUID values anyway, so we only
+    // record the marker table.
+    if (found_non_v4_uuid) {
+        scanner->collect_guids([&](const std::vector<GuidUpdate>& updates) {
+            apply_guid_updates(group, updates);
+        });
     }
 
-
-    group->add_table(c_guid_fix_table);
+    group.add_table(c_guid_fix_table);
     realm->commit_transaction();
 }
 } // namespace realm
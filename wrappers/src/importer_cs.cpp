@@ -0,0 +1,519 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// #include json.hpp needs to be before #include realm.hpp due to https://github.com/nlohmann/json/issues/2129
+#include <external/json/json.hpp>
+
+#include <realm.hpp>
+#include <realm/exceptions.hpp>
+#include <realm/util/base64.hpp>
+#include <realm/util/file.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/object-store/object_schema.hpp>
+
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+#include <chrono>
+#include <deque>
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace {
+
+enum class import_format : uint8_t {
+    NDJSON,
+    CSV,
+};
+
+constexpr size_t c_min_memory_budget = 64 * 1024;
+
+// Maps the fields of the imported records to the persisted properties of the target object type.
+class ImportSchema {
+public:
+    ImportSchema(const ObjectSchema& object_schema)
+        : m_object_schema(object_schema)
+    {
+    }
+
+    // Returns the property the field should be written to or nullptr if the field doesn't map to a property.
+    const Property* find(std::string_view field) const
+    {
+        for (const Property& property : m_object_schema.persisted_properties) {
+            if (property.name == field || (!property.public_name.empty() && property.public_name == field)) {
+                if (is_collection(property.type) || (property.type & ~PropertyType::Flags) == PropertyType::Object) {
+                    throw InvalidArgument(ErrorCodes::InvalidProperty, util::format("Property '%1.%2' can't be imported as only primitive properties are supported.", m_object_schema.name, property.name));
+                }
+
+                return &property;
+            }
+        }
+
+        return nullptr;
+    }
+
+    const ObjectSchema& object_schema() const
+    {
+        return m_object_schema;
+    }
+
+private:
+    const ObjectSchema& m_object_schema;
+};
+
+[[noreturn]] void throw_conversion_error(const ObjectSchema& object_schema, const Property& property, std::string_view text)
+{
+    throw InvalidArgument(ErrorCodes::InvalidArgument, util::format("Value '%1' can't be converted to %2 for property '%3.%4'.",
+        text, to_string(property.type), object_schema.name, property.name));
+}
+
+// Builds the Timestamp from seconds and nanoseconds rather than through a nanosecond duration, which would overflow
+// for dates outside of about 1677-2262. Both parts are truncated towards zero, so they have the same sign.
+Timestamp from_milliseconds(int64_t milliseconds)
+{
+    return Timestamp(milliseconds / 1000, static_cast<int32_t>(milliseconds % 1000) * 1'000'000);
+}
+
+// Converts the textual representation of a value to the type of the property. String values are returned as
+// views into `text`, so it must outlive the returned value. Binary data is read as base64 and decoded into a new
+// element of `decoded`, which must outlive the returned value too. Dates are read as milliseconds since the Unix epoch.
+Mixed parse_value(const ObjectSchema& object_schema, const Property& property, std::string_view text, std::deque<std::string>& decoded)
+{
+    if (text.empty() && property.type != PropertyType::String) {
+        return Mixed();
+    }
+
+    const std::string value(text);
+    char* end = nullptr;
+    switch (property.type & ~PropertyType::Flags) {
+        case PropertyType::Int: {
+            const int64_t result = std::strtoll(value.c_str(), &end, 10);
+            if (*end != '\0') {
+                throw_conversion_error(object_schema, property, text);
+            }
+            return Mixed(result);
+        }
+        case PropertyType::Bool:
+            if (value == "true" || value == "1") {
+                return Mixed(true);
+            }
+            if (value == "false" || value == "0") {
+                return Mixed(false);
+            }
+            throw_conversion_error(object_schema, property, text);
+        case PropertyType::Float:
+        case PropertyType::Double: {
+            const double result = std::strtod(value.c_str(), &end);
+            if (*end != '\0') {
+                throw_conversion_error(object_schema, property, text);
+            }
+            return (property.type & ~PropertyType::Flags) == PropertyType::Float ? Mixed(static_cast<float>(result)) : Mixed(result);
+        }
+        case PropertyType::Date: {
+            const int64_t milliseconds = std::strtoll(value.c_str(), &end, 10);
+            if (*end != '\0') {
+                throw_conversion_error(object_schema, property, text);
+            }
+            return Mixed(from_milliseconds(milliseconds));
+        }
+        case PropertyType::ObjectId:
+            if (!ObjectId::is_valid_str(value)) {
+                throw_conversion_error(object_schema, property, text);
+            }
+            return Mixed(ObjectId(value.c_str()));
+        case PropertyType::UUID:
+            if (!UUID::is_valid_string(value)) {
+                throw_conversion_error(object_schema, property, text);
+            }
+            return Mixed(UUID(value));
+        case PropertyType::Decimal: {
+            const Decimal128 result(StringData(text.data(), text.size()));
+            if (result.is_nan() && value != "NaN") {
+                throw_conversion_error(object_schema, property, text);
+            }
+            return Mixed(result);
+        }
+        case PropertyType::Data: {
+            auto& data = decoded.emplace_back(util::base64_decoded_size(text.size()), '\0');
+            const auto size = util::base64_decode(StringData(text.data(), text.size()), { data.data(), data.size() });
+            if (!size) {
+                throw_conversion_error(object_schema, property, text);
+            }
+            data.resize(*size);
+            return Mixed(BinaryData(data.data(), data.size()));
+        }
+        case PropertyType::String:
+        case PropertyType::Mixed:
+            return Mixed(StringData(text.data(), text.size()));
+        default:
+            throw_conversion_error(object_schema, property, text);
+    }
+}
+
+// Converts a JSON value to the type of the property. Strings are parsed like CSV fields, so that values
+// without a JSON representation (ObjectId, UUID, Decimal128) can be imported.
+Mixed json_to_value(const ObjectSchema& object_schema, const Property& property, const nlohmann::json& json, std::deque<std::string>& decoded)
+{
+    const auto type = property.type & ~PropertyType::Flags;
+    switch (json.type()) {
+        case nlohmann::json::value_t::null:
+            return Mixed();
+        case nlohmann::json::value_t::boolean:
+            if (type != PropertyType::Bool && type != PropertyType::Mixed) {
+                throw_conversion_error(object_schema, property, json.dump());
+            }
+            return Mixed(json.get<bool>());
+        case nlohmann::json::value_t::number_integer:
+        case nlohmann::json::value_t::number_unsigned:
+            switch (type) {
+                case PropertyType::Int:
+                case PropertyType::Mixed:
+                    return Mixed(json.get<int64_t>());
+                case PropertyType::Float:
+                    return Mixed(json.get<float>());
+                case PropertyType::Double:
+                    return Mixed(json.get<double>());
+                case PropertyType::Decimal:
+                    return Mixed(Decimal128(json.get<int64_t>()));
+                case PropertyType::Date:
+                    return Mixed(from_milliseconds(json.get<int64_t>()));
+                default:
+                    throw_conversion_error(object_schema, property, json.dump());
+            }
+        case nlohmann::json::value_t::number_float:
+            switch (type) {
+                case PropertyType::Float:
+                    return Mixed(json.get<float>());
+                case PropertyType::Double:
+                case PropertyType::Mixed:
+                    return Mixed(json.get<double>());
+                case PropertyType::Decimal:
+                    return Mixed(Decimal128(json.get<double>()));
+                default:
+                    throw_conversion_error(object_schema, property, json.dump());
+            }
+        case nlohmann::json::value_t::string: {
+            const auto& string = json.get_ref<const std::string&>();
+            return parse_value(object_schema, property, string, decoded);
+        }
+        default:
+            throw_conversion_error(object_schema, property, json.dump());
+    }
+}
+
+class Importer {
+public:
+    Importer(SharedRealm& realm, TableKey table_key, import_format format, size_t chunk_size, size_t memory_budget, void* managed_progress)
+        : m_realm(realm)
+        , m_table_key(table_key)
+        , m_schema(*realm->schema().find(table_key))
+        , m_format(format)
+        , m_chunk_size(std::max<size_t>(chunk_size, 1))
+        , m_buffer(std::max(memory_budget, c_min_memory_budget))
+        , m_managed_progress(managed_progress)
+    {
+    }
+
+    uint64_t run(const std::string& path)
+    {
+        util::File file(path, util::File::mode_Read);
+        m_total_bytes = file.get_size();
+        m_start = std::chrono::steady_clock::now();
+
+        m_realm->begin_transaction();
+        try {
+            size_t buffered = 0;
+            bool at_end = false;
+            while (!at_end) {
+                const size_t read = file.read(m_buffer.data() + buffered, m_buffer.size() - buffered);
+                at_end = read == 0;
+                buffered += read;
+
+                const size_t consumed = process_records(std::string_view(m_buffer.data(), buffered), at_end);
+                if (consumed == 0 && buffered == m_buffer.size()) {
+                    throw InvalidArgument(ErrorCodes::LimitExceeded, util::format("A record in '%1' is larger than the import memory budget of %2 bytes.", path, m_buffer.size()));
+                }
+
+                std::memmove(m_buffer.data(), m_buffer.data() + consumed, buffered - consumed);
+                buffered -= consumed;
+
+                if (m_cancelled) {
+                    break;
+                }
+            }
+
+            m_realm->commit_transaction();
+            report_progress();
+        }
+        catch (...) {
+            if (m_realm->is_in_transaction()) {
+                m_realm->cancel_transaction();
+            }
+            throw;
+        }
+
+        return m_rows;
+    }
+
+private:
+    SharedRealm m_realm;
+    TableKey m_table_key;
+    ImportSchema m_schema;
+    import_format m_format;
+    size_t m_chunk_size;
+    std::vector<char> m_buffer;
+    void* m_managed_progress;
+
+    std::vector<const Property*> m_csv_columns;
+    bool m_csv_header_read = false;
+
+    // Decoded binary values of the record being imported. A deque, so that adding a value doesn't move the others.
+    std::deque<std::string> m_decoded;
+
+    uint64_t m_rows = 0;
+    uint64_t m_rows_in_chunk = 0;
+    uint64_t m_bytes = 0;
+    uint64_t m_total_bytes = 0;
+    bool m_cancelled = false;
+    std::chrono::steady_clock::time_point m_start;
+
+    // Imports the complete records in `data` and returns the number of bytes they spanned. A trailing record
+    // without a line terminator is only imported once the end of the file was reached.
+    size_t process_records(std::string_view data, bool at_end)
+    {
+        size_t position = 0;
+        while (position < data.size() && !m_cancelled) {
+            const size_t record_end = find_record_end(data, position);
+            if (record_end == std::string_view::npos && !at_end) {
+                break;
+            }
+
+            const size_t end = record_end == std::string_view::npos ? data.size() : record_end;
+            std::string_view record = data.substr(position, end - position);
+            if (!record.empty() && record.back() == '\r') {
+                record.remove_suffix(1);
+            }
+
+            const size_t next = record_end == std::string_view::npos ? data.size() : record_end + 1;
+            m_bytes += next - position;
+            position = next;
+
+            if (!record.empty()) {
+                import_record(record);
+            }
+        }
+
+        return position;
+    }
+
+    size_t find_record_end(std::string_view data, size_t position) const
+    {
+        if (m_format == import_format::NDJSON) {
+            return data.find('\n', position);
+        }
+
+        // CSV fields may contain line breaks if they are quoted
+        bool in_quotes = false;
+        for (size_t i = position; i < data.size(); ++i) {
+            if (data[i] == '"') {
+                in_quotes = !in_quotes;
+            }
+            else if (data[i] == '\n' && !in_quotes) {
+                return i;
+            }
+        }
+
+        return std::string_view::npos;
+    }
+
+    void import_record(std::string_view record)
+    {
+        if (m_format == import_format::NDJSON) {
+            import_json(record);
+        }
+        else if (!m_csv_header_read) {
+            for (const auto& field : split_csv(record)) {
+                m_csv_columns.push_back(m_schema.find(field));
+            }
+            m_csv_header_read = true;
+            return;
+        }
+        else {
+            import_csv(record);
+        }
+
+        if (++m_rows_in_chunk == m_chunk_size) {
+            commit_chunk();
+        }
+    }
+
+    void import_json(std::string_view record)
+    {
+        const auto json = nlohmann::json::parse(record.begin(), record.end());
+        if (!json.is_object()) {
+            throw InvalidArgument(ErrorCodes::InvalidArgument, util::format("Expected a JSON object, but got '%1'.", json.dump()));
+        }
+
+        std::vector<std::pair<const Property*, Mixed>> values;
+        values.reserve(json.size());
+        for (const auto& [field, value] : json.items()) {
+            if (const Property* property = m_schema.find(field)) {
+                values.emplace_back(property, json_to_value(m_schema.object_schema(), *property, value, m_decoded));
+            }
+        }
+
+        write_object(values);
+        m_decoded.clear();
+    }
+
+    void import_csv(std::string_view record)
+    {
+        const auto fields = split_csv(record);
+        if (fields.size() != m_csv_columns.size()) {
+            throw InvalidArgument(ErrorCodes::InvalidArgument, util::format("Expected %1 fields, but got %2 in record %3.", m_csv_columns.size(), fields.size(), m_rows + 1));
+        }
+
+        std::vector<std::pair<const Property*, Mixed>> values;
+        values.reserve(fields.size());
+        for (size_t i = 0; i < fields.size(); ++i) {
+            if (const Property* property = m_csv_columns[i]) {
+                values.emplace_back(property, parse_value(m_schema.object_schema(), *property, fields[i], m_decoded));
+            }
+        }
+
+        write_object(values);
+        m_decoded.clear();
+    }
+
+    void write_object(const std::vector<std::pair<const Property*, Mixed>>& values)
+    {
+        const ObjectSchema& object_schema = m_schema.object_schema();
+        const TableRef table = get_table(m_realm, m_table_key);
+
+        Obj obj;
+        if (const Property* primary_key_property = object_schema.primary_key_property()) {
+            auto it = std::find_if(values.begin(), values.end(), [&](const auto& value) {
+                return value.first == primary_key_property;
+            });
+            if (it == values.end()) {
+                throw InvalidArgument(ErrorCodes::MissingValue, util::format("Record %1 doesn't have a value for the primary key '%2'.", m_rows + 1, primary_key_property->name));
+            }
+            obj = table->create_object_with_primary_key(it->second);
+        }
+        else {
+            obj = table->create_object();
+        }
+
+        for (const auto& [property, value] : values) {
+            if (property->is_primary) {
+                continue;
+            }
+
+            if (value.is_null() && !is_nullable(property->type)) {
+                throw NotNullable(object_schema.name, property->name);
+            }
+
+            obj.set_any(property->column_key, value);
+        }
+
+        ++m_rows;
+    }
+
+    void commit_chunk()
+    {
+        m_realm->commit_transaction();
+        m_rows_in_chunk = 0;
+        m_cancelled = !report_progress();
+        m_realm->begin_transaction();
+    }
+
+    bool report_progress()
+    {
+        if (!m_managed_progress) {
+            return true;
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+        return s_operation_progress(m_managed_progress, m_rows, m_bytes, m_total_bytes, elapsed.count());
+    }
+
+    // Splits a CSV record into its fields, removing the quotes around quoted fields. The returned strings
+    // own their data as unescaping "" requires a copy anyway.
+    static std::vector<std::string> split_csv(std::string_view record)
+    {
+        std::vector<std::string> fields;
+        std::string field;
+        bool in_quotes = false;
+        for (size_t i = 0; i < record.size(); ++i) {
+            const char c = record[i];
+            if (in_quotes) {
+                if (c == '"' && i + 1 < record.size() && record[i + 1] == '"') {
+                    field += '"';
+                    ++i;
+                }
+                else if (c == '"') {
+                    in_quotes = false;
+                }
+                else {
+                    field += c;
+                }
+            }
+            else if (c == '"') {
+                in_quotes = true;
+            }
+            else if (c == ',') {
+                fields.push_back(std::move(field));
+                field.clear();
+            }
+            else {
+                field += c;
+            }
+        }
+
+        fields.push_back(std::move(field));
+        return fields;
+    }
+};
+
+} // anonymous namespace
+
+extern "C" {
+
+// Imports the NDJSON or CSV file at `path_buf` into the given table, committing every `chunk_size` records. The file
+// is read through a buffer of `memory_budget` bytes, which needs to fit the largest record. If `managed_progress`
+// is set, progress is reported after each chunk and the import stops if the callback returns false. Chunks that
+// were committed before an error remain in the Realm. Returns the number of imported records.
+REALM_EXPORT uint64_t shared_realm_import_file(SharedRealm& realm, TableKey table_key, uint16_t* path_buf, size_t path_len, import_format format,
+    size_t chunk_size, size_t memory_budget, void* managed_progress, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        realm->verify_thread();
+        if (realm->is_in_transaction()) {
+            throw WrongTransactionState("Files can't be imported while the Realm is in a write transaction as the import commits its own transactions.");
+        }
+
+        Utf16StringAccessor path(path_buf, path_len);
+        Importer importer(realm, table_key, format, chunk_size, memory_budget, managed_progress);
+        return importer.run(path.to_string());
+    });
+}
+
+}   // extern "C"
@@ -0,0 +1,175 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace realm::binding {
+
+struct latency_summary {
+    uint64_t count;
+    uint64_t mean_ns;
+    uint64_t p50_ns;
+    uint64_t p90_ns;
+    uint64_t p99_ns;
+    uint64_t max_ns;
+};
+
+// A lock-free latency histogram with log-linear buckets, in the style of HdrHistogram. Values below 32ns get a
+// bucket each, larger ones are bucketed by their highest set bit and the 4 bits following it, which bounds the
+// error of the reported percentiles to 1/16 of the value. Recording is a handful of relaxed atomic increments,
+// so it can be done from any thread while another one reads the histogram.
+class LatencyHistogram {
+public:
+    void record(std::chrono::nanoseconds duration)
+    {
+        const uint64_t value = duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : 0;
+        m_buckets[bucket_for(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t max = m_max.load(std::memory_order_relaxed);
+        while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    latency_summary summarize() const
+    {
+        latency_summary summary{};
+        summary.count = m_count.load(std::memory_order_relaxed);
+        if (summary.count == 0) {
+            return summary;
+        }
+
+        summary.mean_ns = m_sum.load(std::memory_order_relaxed) / summary.count;
+        summary.max_ns = m_max.load(std::memory_order_relaxed);
+
+        // Buckets may be incremented while we walk them, so percentiles are computed against the
+        // total we actually see rather than m_count.
+        std::array<uint64_t, c_bucket_count> counts;
+        uint64_t total = 0;
+        for (size_t i = 0; i < c_bucket_count; ++i) {
+            counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        summary.p50_ns = percentile(counts, total, 0.50);
+        summary.p90_ns = percentile(counts, total, 0.90);
+        summary.p99_ns = percentile(counts, total, 0.99);
+        return summary;
+    }
+
+private:
+    static constexpr size_t c_linear_buckets = 32;
+    static constexpr size_t c_sub_buckets = 16;
+    static constexpr size_t c_bucket_count = c_linear_buckets + 59 * c_sub_buckets;
+
+    std::array<std::atomic<uint64_t>, c_bucket_count> m_buckets{};
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<uint64_t> m_sum{0};
+    std::atomic<uint64_t> m_max{0};
+
+    static size_t bucket_for(uint64_t value)
+    {
+        if (value < c_linear_buckets) {
+            return static_cast<size_t>(value);
+        }
+
+        size_t highest_bit = 0;
+        for (uint64_t v = value; v > 1; v >>= 1) {
+            ++highest_bit;
+        }
+
+        const size_t shift = highest_bit - 4;
+        return (shift + 1) * c_sub_buckets + static_cast<size_t>((value >> shift) - c_sub_buckets);
+    }
+
+    // The lowest value that falls into the bucket.
+    static uint64_t value_for(size_t bucket)
+    {
+        if (bucket < c_linear_buckets) {
+            return bucket;
+        }
+
+        const size_t shift = bucket / c_sub_buckets - 1;
+        return (c_sub_buckets + bucket % c_sub_buckets) << shift;
+    }
+
+    static uint64_t percentile(const std::array<uint64_t, c_bucket_count>& counts, uint64_t total, double fraction)
+    {
+        const uint64_t target = static_cast<uint64_t>(fraction * total + 0.5);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < c_bucket_count; ++i) {
+            seen += counts[i];
+            if (seen >= target && seen > 0) {
+                return value_for(i);
+            }
+        }
+
+        return 0;
+    }
+};
+
+struct transaction_metrics {
+    latency_summary write_lock_wait;
+    latency_summary transaction;
+    latency_summary commit;
+    latency_summary refresh;
+};
+
+// Write transaction timings for a single Realm. Recorded by the transaction exports when metrics are enabled
+// for the Realm, see CSharpBindingContext::metrics().
+class TransactionMetrics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    LatencyHistogram write_lock_wait;
+    LatencyHistogram transaction;
+    LatencyHistogram commit;
+    LatencyHistogram refresh;
+
+    void transaction_started()
+    {
+        m_transaction_start = Clock::now();
+    }
+
+    // Records how long the transaction has been open, if it was started while metrics were enabled.
+    void transaction_ended()
+    {
+        if (m_transaction_start) {
+            transaction.record(Clock::now() - *m_transaction_start);
+            m_transaction_start.reset();
+        }
+    }
+
+    transaction_metrics summarize() const
+    {
+        return { write_lock_wait.summarize(), transaction.summarize(), commit.summarize(), refresh.summarize() };
+    }
+
+private:
+    // Only touched on the Realm's thread
+    std::optional<Clock::time_point> m_transaction_start;
+};
+
+} // namespace realm::binding
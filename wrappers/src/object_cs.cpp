@@ -46,6 +46,31 @@ REALM_FORCEINLINE KeyPathArray construct_key_path_array(const ObjectSchema& obje
     return keyPathArray;
 }
 
+// The table and column that link to `object` through its LinkingObjects property at `property_ndx`.
+inline std::pair<TableRef, ColKey> get_backlink_origin(const Object& object, size_t property_ndx)
+{
+    const Property& prop = object.get_object_schema().computed_properties[property_ndx];
+    REALM_ASSERT(prop.type == PropertyType::LinkingObjects);
+
+    const ObjectSchema& relationship = *object.realm()->schema().find(prop.object_type);
+    const Property& link = *relationship.property_for_name(prop.link_origin_property_name);
+
+    return { object.realm()->read_group().get_table(relationship.table_key), link.column_key };
+}
+
+// The table and column that link to `object` through the property at `source_property_ndx` of the table at `table_key`.
+inline std::pair<TableRef, ColKey> get_backlink_origin(const Object& object, TableKey table_key, size_t source_property_ndx)
+{
+    const ObjectSchema& source_object_schema = *object.realm()->schema().find(table_key);
+    const Property& source_property = source_object_schema.persisted_properties[source_property_ndx];
+
+    if (source_property.object_type != object.get_object_schema().name) {
+        throw InvalidArgument(ErrorCodes::InvalidProperty, util::format("'%1.%2' is not a relationship to '%3'", source_object_schema.name, source_property.name, object.get_object_schema().name));
+    }
+
+    return { get_table(object.realm(), table_key), source_property.column_key };
+}
+
 extern "C" {
     REALM_EXPORT bool object_get_is_valid(const Object& object, NativeException::Marshallable& ex)
     {
@@ -203,21 +228,14 @@ extern "C" {
         });
     }
 
+    // Unlike Obj::get_backlink_view(), the view isn't synced here, so the linking objects are only collected when the
+    // Results is first read, and queries on it are only evaluated against them.
     REALM_EXPORT Results* object_get_backlinks(Object& object, size_t property_ndx, NativeException::Marshallable& ex)
     {
         return handle_errors(ex, [&] {
             verify_can_get(object);
-            const Property& prop = object.get_object_schema().computed_properties[property_ndx];
-            REALM_ASSERT(prop.type == PropertyType::LinkingObjects);
-
-            const ObjectSchema& relationship = *object.realm()->schema().find(prop.object_type);
-            const Property& link = *relationship.property_for_name(prop.link_origin_property_name);
-
-            TableRef table = object.realm()->read_group().get_table(relationship.table_key);
-            const ColKey column = link.column_key;
-
-            TableView backlink_view = object.get_obj().get_backlink_view(table, column);
-            return new Results(object.realm(), std::move(backlink_view));
+            auto [table, column] = get_backlink_origin(object, property_ndx);
+            return new Results(object.realm(), TableView(table, column, object.get_obj()));
         });
     }
 
@@ -225,18 +243,27 @@ extern "C" {
     {
         return handle_errors(ex, [&] {
             verify_can_get(object);
+            auto [table, column] = get_backlink_origin(object, table_key, source_property_ndx);
+            return new Results(object.realm(), TableView(table, column, object.get_obj()));
+        });
+    }
 
-            const TableRef source_table = get_table(object.realm(), table_key);
-
-            const ObjectSchema& source_object_schema = *object.realm()->schema().find(table_key);
-            const Property& source_property = source_object_schema.persisted_properties[source_property_ndx];
-
-            if (source_property.object_type != object.get_object_schema().name) {
-                throw InvalidArgument(ErrorCodes::InvalidProperty, util::format("'%1.%2' is not a relationship to '%3'", source_object_schema.name, source_property.name, object.get_object_schema().name));
-            }
+    // Reads the size of the backlink list for the given origin, without collecting the linking objects.
+    REALM_EXPORT size_t object_get_backlink_count_for_property(Object& object, size_t property_ndx, NativeException::Marshallable& ex)
+    {
+        return handle_errors(ex, [&] {
+            verify_can_get(object);
+            auto [table, column] = get_backlink_origin(object, property_ndx);
+            return object.get_obj().get_backlink_count(*table, column);
+        });
+    }
 
-            TableView backlink_view = object.get_obj().get_backlink_view(source_table, source_property.column_key);
-            return new Results(object.realm(), std::move(backlink_view));
+    REALM_EXPORT size_t object_get_backlink_count_for_type(Object& object, TableKey table_key, size_t source_property_ndx, NativeException::Marshallable& ex)
+    {
+        return handle_errors(ex, [&] {
+            verify_can_get(object);
+            auto [table, column] = get_backlink_origin(object, table_key, source_property_ndx);
+            return object.get_obj().get_backlink_count(*table, column);
         });
     }
 
@@ -295,16 +322,14 @@ extern "C" {
         });
     }
 
-    REALM_EXPORT int32_t object_get_hashcode(const Object& object, NativeException::Marshallable& ex)
+    // The keys of an Object never change, so the managed side reads them once per handle and compares and hashes
+    // objects by them without calling back in. Detached objects report default keys.
+    REALM_EXPORT void object_get_keys(const Object& object, TableKey& table_key, int64_t& obj_key, NativeException::Marshallable& ex)
     {
-        return handle_errors(ex, [&]() {
-            int32_t table_key_value = static_cast<int32_t>(object.get_obj().get_table()->get_key().value);
-            int32_t object_key_value = static_cast<int32_t>(object.get_obj().get_key().value);
-
-            int32_t hashCode = -986587137;
-            hashCode = (hashCode * -1521134295) + table_key_value;
-            hashCode = (hashCode * -1521134295) + object_key_value;
-            return hashCode;
+        handle_errors(ex, [&]() {
+            const Obj& obj = object.get_obj();
+            table_key = obj.get_table() ? obj.get_table()->get_key() : TableKey();
+            obj_key = obj.get_key().value;
         });
     }
 
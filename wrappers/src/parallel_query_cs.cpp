@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm.hpp>
+#include <realm/object-store/results.hpp>
+
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+#include "worker_pool_cs.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace realm::binding {
+
+// The objects matched by a frozen Results, found by evaluating its query on the worker pool. The table is split
+// into contiguous ranges of objects, which are in ObjKey order, and each range is evaluated with its own copy of the
+// query. Concatenating the matches of each range then gives them in key order without a merge step. Frozen Realms
+// can be read from any thread, so all ranges share the Results' Realm.
+class ParallelQueryResult {
+public:
+    ParallelQueryResult(const Results& results, size_t max_threads)
+        : m_realm(results.get_realm())
+        , m_table(results.get_table())
+    {
+        if (!m_table) {
+            return;
+        }
+
+        auto& pool = WorkerPool::shared();
+        const size_t table_size = m_table->size();
+        const size_t range_count = std::max<size_t>(1, std::min({ max_threads, pool.thread_count() + 1, table_size / c_min_objects_per_thread }));
+        const size_t range_size = (table_size + range_count - 1) / range_count;
+
+        std::vector<std::vector<ObjKey>> matches(range_count);
+        const Query query = results.get_query();
+        pool.parallel_for(range_count, [&](size_t range) {
+            Query range_query(query);
+            const size_t end = std::min(table_size, (range + 1) * range_size);
+            for (size_t ndx = range * range_size; ndx < end; ++ndx) {
+                Obj obj = m_table->get_object(ndx);
+                if (range_query.eval_object(obj)) {
+                    matches[range].push_back(obj.get_key());
+                }
+            }
+        });
+
+        size_t total = 0;
+        for (const auto& range_matches : matches) {
+            total += range_matches.size();
+        }
+
+        m_keys.reserve(total);
+        for (const auto& range_matches : matches) {
+            m_keys.insert(m_keys.end(), range_matches.begin(), range_matches.end());
+        }
+    }
+
+    size_t count() const
+    {
+        return m_keys.size();
+    }
+
+    size_t get_objects(size_t start, realm_value_t* buffer, size_t buffer_size) const
+    {
+        size_t count = 0;
+        for (size_t ndx = start; ndx < m_keys.size() && count < buffer_size; ++ndx) {
+            buffer[count++] = to_capi(m_table->get_object(m_keys[ndx]), m_realm);
+        }
+
+        return count;
+    }
+
+private:
+    // Below this, handing a range to another thread costs more than evaluating the query on it.
+    static constexpr size_t c_min_objects_per_thread = 4096;
+
+    SharedRealm m_realm;
+    ConstTableRef m_table;
+    std::vector<ObjKey> m_keys;
+};
+
+} // namespace realm::binding
+
+extern "C" {
+
+// Evaluates the query of a frozen Results on up to `max_threads` threads. Sorting, distinct and limits aren't
+// applied, so the Results must not have any.
+REALM_EXPORT ParallelQueryResult* results_evaluate_parallel(const Results& results, size_t max_threads, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        if (!results.is_frozen()) {
+            throw LogicError(ErrorCodes::WrongTransactionState, "Only frozen results can be evaluated in parallel.");
+        }
+
+        // Ranges are evaluated against the query's conditions only, which would ignore a restriction to a list, set
+        // or TableView.
+        const auto mode = results.get_mode();
+        if ((mode != Results::Mode::Table && mode != Results::Mode::Query) || !results.get_query().produces_results_in_table_order()) {
+            throw LogicError(ErrorCodes::IllegalOperation, "Only results of a query on a table can be evaluated in parallel.");
+        }
+
+        if (!results.get_descriptor_ordering().is_empty()) {
+            throw LogicError(ErrorCodes::IllegalOperation, "Sorted, distinct or limited results can't be evaluated in parallel.");
+        }
+
+        return new ParallelQueryResult(results, max_threads);
+    });
+}
+
+REALM_EXPORT void parallel_query_result_destroy(ParallelQueryResult* result)
+{
+    delete result;
+}
+
+REALM_EXPORT size_t parallel_query_result_count(const ParallelQueryResult& result, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return result.count();
+    });
+}
+
+// Copies up to `buffer_size` matched objects, starting at `start`, to `buffer` and returns how many were copied.
+REALM_EXPORT size_t parallel_query_result_get_objects(const ParallelQueryResult& result, size_t start, realm_value_t* buffer, size_t buffer_size, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return result.get_objects(start, buffer, buffer_size);
+    });
+}
+
+}   // extern "C"
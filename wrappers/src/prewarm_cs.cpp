@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm.hpp>
+#include <realm/util/file.hpp>
+#include <realm/object-store/shared_realm.hpp>
+
+#include "error_handling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+#include <vector>
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace {
+
+constexpr size_t c_read_chunk_size = 1 << 20;
+
+// Reads the file sequentially, so that the pages are in the OS page cache by the time they're mapped and faulted in.
+uint64_t prewarm_file(const std::string& path, uint64_t budget_bytes)
+{
+    util::File file(path, util::File::mode_Read);
+    const uint64_t size = std::min(static_cast<uint64_t>(file.get_size()), budget_bytes);
+
+    std::vector<char> buffer(c_read_chunk_size);
+    uint64_t read = 0;
+    while (read < size) {
+        const size_t chunk = static_cast<size_t>(std::min<uint64_t>(c_read_chunk_size, size - read));
+        const size_t bytes = file.read(buffer.data(), chunk);
+        if (bytes == 0) {
+            break;
+        }
+        read += bytes;
+    }
+
+    return read;
+}
+
+// Reads every non-collection value in the table, which faults in the cluster tree and the leaves of each column.
+// The returned size is an estimate of the data touched: the size of string and binary values and 8 bytes for
+// anything else.
+uint64_t prewarm_table(const ConstTableRef& table, uint64_t budget_bytes)
+{
+    std::vector<ColKey> columns;
+    for (ColKey column : table->get_column_keys()) {
+        if (!column.is_collection()) {
+            columns.push_back(column);
+        }
+    }
+
+    uint64_t touched = 0;
+    for (const Obj& obj : *table) {
+        if (touched >= budget_bytes) {
+            break;
+        }
+
+        for (ColKey column : columns) {
+            const Mixed value = obj.get_any(column);
+            if (value.is_type(type_String)) {
+                touched += value.get_string().size();
+            }
+            else if (value.is_type(type_Binary)) {
+                touched += value.get_binary().size();
+            }
+            else {
+                touched += sizeof(uint64_t);
+            }
+        }
+    }
+
+    return touched;
+}
+
+} // anonymous namespace
+
+extern "C" {
+
+// Pulls data into memory ahead of the first queries, stopping once about `budget_bytes` have been read. With no
+// table keys, the whole file is read into the page cache; otherwise the values of the given tables are read through
+// the Realm. Returns the number of bytes read. Meant to be called on a frozen Realm from a background thread.
+REALM_EXPORT uint64_t shared_realm_prewarm(SharedRealm& realm, uint32_t* table_keys, size_t table_keys_count, uint64_t budget_bytes, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() -> uint64_t {
+        realm->verify_thread();
+
+        if (table_keys_count == 0) {
+            return prewarm_file(realm->config().path, budget_bytes);
+        }
+
+        uint64_t touched = 0;
+        for (size_t i = 0; i < table_keys_count && touched < budget_bytes; ++i) {
+            touched += prewarm_table(get_table(realm, TableKey(table_keys[i])), budget_bytes - touched);
+        }
+
+        return touched;
+    });
+}
+
+}   // extern "C"
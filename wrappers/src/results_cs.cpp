@@ -22,6 +22,7 @@
 #include <realm/object-store/object_accessor.hpp>
 #include <realm/object-store/thread_safe_reference.hpp>
 #include <realm/object-store/results.hpp>
+#include <realm/sort_descriptor.hpp>
 
 #include "error_handling.hpp"
 #include "filter.hpp"
@@ -29,10 +30,31 @@
 #include "notifications_cs.hpp"
 #include "schema_cs.hpp"
 #include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+#include <chrono>
 
 using namespace realm;
 using namespace realm::binding;
 
+namespace {
+using Clock = std::chrono::steady_clock;
+
+struct query_explanation {
+    size_t table_size;
+    size_t matched_count;
+    size_t result_count;
+    uint64_t query_nanoseconds;
+    uint64_t sort_nanoseconds;
+    uint64_t descriptors_nanoseconds;
+};
+
+inline uint64_t nanoseconds_between(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+}
+
 extern "C" {
 
 REALM_EXPORT void results_destroy(Results* results)
@@ -87,7 +109,16 @@ REALM_EXPORT size_t results_count(Results& results, NativeException::Marshallabl
     return handle_errors(ex, [&]() {
         results.get_realm()->verify_thread();
 
-        return results.size();
+        const auto mode = results.get_mode();
+        if ((mode != Results::Mode::Query && mode != Results::Mode::TableView) || get_slow_query_threshold(results.get_realm()).count() == 0) {
+            return results.size();
+        }
+
+        const auto start = Clock::now();
+        const auto count = results.size();
+        report_query_duration(results.get_realm(), results.get_query(), Clock::now() - start);
+
+        return count;
     });
 }
 
@@ -177,4 +208,61 @@ REALM_EXPORT size_t results_get_description(Results& results, uint16_t* buffer,
     });
 }
 
+// Evaluates the query and descriptors behind a Results from scratch and reports how long each stage took.
+// Core doesn't expose per-condition statistics, so the counts are for the query as a whole. The sort stage is
+// timed on its own by applying just the sort descriptors, the descriptors stage is the remainder of applying
+// the full ordering (distinct, limit and filter).
+REALM_EXPORT void results_explain(Results& results, query_explanation* explanation, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        results.get_realm()->verify_thread();
+
+        *explanation = {};
+
+        auto table = results.get_table();
+        if (!table) {
+            return;
+        }
+
+        Query query = results.get_query();
+        const DescriptorOrdering& ordering = results.get_descriptor_ordering();
+
+        explanation->table_size = table->size();
+
+        auto start = Clock::now();
+        TableView view = query.find_all();
+        auto end = Clock::now();
+        explanation->query_nanoseconds = nanoseconds_between(start, end);
+        explanation->matched_count = view.size();
+
+        if (ordering.will_apply_sort()) {
+            DescriptorOrdering sort_only;
+            for (size_t i = 0; i < ordering.size(); ++i) {
+                if (ordering.get_type(i) == DescriptorType::Sort) {
+                    sort_only.append_sort(*static_cast<const SortDescriptor*>(ordering[i]));
+                }
+            }
+
+            TableView sorted(view);
+            start = Clock::now();
+            sorted.apply_descriptor_ordering(sort_only);
+            end = Clock::now();
+            explanation->sort_nanoseconds = nanoseconds_between(start, end);
+        }
+
+        if (!ordering.is_empty()) {
+            start = Clock::now();
+            view.apply_descriptor_ordering(ordering);
+            end = Clock::now();
+
+            const auto total = nanoseconds_between(start, end);
+            explanation->descriptors_nanoseconds = total > explanation->sort_nanoseconds ? total - explanation->sort_nanoseconds : 0;
+        }
+
+        explanation->result_count = view.size();
+
+        report_query_duration(results.get_realm(), query, std::chrono::nanoseconds(explanation->query_nanoseconds + explanation->sort_nanoseconds + explanation->descriptors_nanoseconds));
+    });
+}
+
 }   // extern "C"
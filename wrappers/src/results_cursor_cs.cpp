@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm.hpp>
+#include <realm/sort_descriptor.hpp>
+#include <realm/object-store/results.hpp>
+
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+#include <optional>
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace realm::binding {
+
+struct cursor_sort_clause {
+    size_t property_index;
+    bool ascending;
+};
+
+// A keyset cursor over the objects matched by a Results. Rather than addressing objects by their offset,
+// the cursor remembers the sort key values and the ObjKey of the last object it returned and seeks past
+// them when the next page is requested. This keeps the cost of a page independent of how far into the
+// collection we are, and objects inserted or deleted between pages don't cause others to be skipped or repeated.
+//
+// Ties between objects with equal sort keys are broken by ObjKey, which is the order in which Core's
+// (stable) sort leaves them.
+class ResultsCursor {
+public:
+    ResultsCursor(const Results& results, std::vector<ColKey> sort_columns, std::vector<bool> ascending)
+        : m_realm(results.get_realm())
+        , m_table(results.get_table())
+        , m_query(results.get_query())
+        , m_sort_columns(std::move(sort_columns))
+        , m_ascending(std::move(ascending))
+    {
+    }
+
+    size_t next_page(realm_value_t* buffer, size_t buffer_size)
+    {
+        m_realm->verify_thread();
+
+        if (!m_table || buffer_size == 0) {
+            return 0;
+        }
+
+        return m_sort_columns.empty() ? next_page_in_key_order(buffer, buffer_size) : next_sorted_page(buffer, buffer_size);
+    }
+
+    void reset()
+    {
+        m_position = 0;
+        m_last_key = ObjKey();
+        m_last_values.clear();
+        m_last_value_storage.clear();
+    }
+
+private:
+    SharedRealm m_realm;
+    ConstTableRef m_table;
+    Query m_query;
+    std::vector<ColKey> m_sort_columns;
+    std::vector<bool> m_ascending;
+
+    std::optional<TableView> m_sorted_view;
+    size_t m_position = 0;
+
+    ObjKey m_last_key;
+    std::vector<Mixed> m_last_values;
+
+    // Backing storage for string and binary values in m_last_values, as those would otherwise
+    // point into the Realm file and may be invalidated by a write.
+    std::vector<std::string> m_last_value_storage;
+
+    // Objects in a table are stored in ObjKey order, so without a sort we can binary search for the
+    // first object after the last one we returned and evaluate the query from there.
+    size_t next_page_in_key_order(realm_value_t* buffer, size_t buffer_size)
+    {
+        const size_t table_size = m_table->size();
+
+        size_t ndx = 0;
+        if (m_last_key) {
+            size_t high = table_size;
+            while (ndx < high) {
+                const size_t mid = ndx + (high - ndx) / 2;
+                if (m_table->get_object(mid).get_key() <= m_last_key) {
+                    ndx = mid + 1;
+                }
+                else {
+                    high = mid;
+                }
+            }
+        }
+
+        size_t count = 0;
+        for (; ndx < table_size && count < buffer_size; ++ndx) {
+            Obj obj = m_table->get_object(ndx);
+            if (m_query.eval_object(obj)) {
+                remember(obj);
+                buffer[count++] = to_capi(std::move(obj), m_realm);
+            }
+        }
+
+        return count;
+    }
+
+    // The sorted objects are kept in a TableView that is only re-evaluated when the table has changed, so paging
+    // through unchanged data costs one sort for the whole cursor and O(page size) per page. After a change, the
+    // position of the last returned object is found again with a binary search over the re-sorted view.
+    size_t next_sorted_page(realm_value_t* buffer, size_t buffer_size)
+    {
+        if (!m_sorted_view) {
+            std::vector<std::vector<ExtendedColumnKey>> column_keys;
+            column_keys.reserve(m_sort_columns.size());
+            for (auto col : m_sort_columns) {
+                column_keys.push_back({ col });
+            }
+
+            DescriptorOrdering ordering;
+            ordering.append_sort(SortDescriptor(std::move(column_keys), m_ascending));
+            m_sorted_view = m_query.find_all(ordering);
+            m_position = seek();
+        }
+        else if (!m_sorted_view->is_in_sync()) {
+            m_sorted_view->sync_if_needed();
+            m_position = seek();
+        }
+        else if (!is_last_at_position()) {
+            m_position = seek();
+        }
+
+        size_t count = 0;
+        for (; m_position < m_sorted_view->size() && count < buffer_size; ++m_position) {
+            Obj obj = m_sorted_view->get_object(m_position);
+            remember(obj);
+            buffer[count++] = to_capi(std::move(obj), m_realm);
+        }
+
+        return count;
+    }
+
+    // Whether the object before m_position is still the last one we returned, with the same sort keys.
+    bool is_last_at_position() const
+    {
+        if (!m_last_key) {
+            return m_position == 0;
+        }
+
+        if (m_position == 0 || m_position > m_sorted_view->size() || m_sorted_view->get_key(m_position - 1) != m_last_key) {
+            return false;
+        }
+
+        const Obj obj = m_sorted_view->get_object(m_position - 1);
+        for (size_t i = 0; i < m_sort_columns.size(); ++i) {
+            if (obj.get_any(m_sort_columns[i]) != m_last_values[i]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Finds the index of the first object in the sorted view that sorts after the last returned one.
+    size_t seek() const
+    {
+        if (!m_last_key) {
+            return 0;
+        }
+
+        size_t low = 0;
+        size_t high = m_sorted_view->size();
+        while (low < high) {
+            const size_t mid = low + (high - low) / 2;
+            if (sorts_after_last(m_sorted_view->get_object(mid))) {
+                high = mid;
+            }
+            else {
+                low = mid + 1;
+            }
+        }
+
+        return low;
+    }
+
+    // Compares `obj` with the last returned object the same way the sort does: by each sort key in the column's
+    // direction and then by ObjKey, which is the order in which Core's (stable) sort leaves ties.
+    bool sorts_after_last(const Obj& obj) const
+    {
+        for (size_t i = 0; i < m_sort_columns.size(); ++i) {
+            const int comparison = obj.get_any(m_sort_columns[i]).compare(m_last_values[i]);
+            if (comparison != 0) {
+                return m_ascending[i] ? comparison > 0 : comparison < 0;
+            }
+        }
+
+        return obj.get_key() > m_last_key;
+    }
+
+    void remember(const Obj& obj)
+    {
+        m_last_key = obj.get_key();
+        m_last_values.clear();
+        m_last_value_storage.clear();
+
+        // Reserve upfront so that the strings are never moved - with small string optimization,
+        // moving would invalidate the pointers held by m_last_values.
+        m_last_value_storage.reserve(m_sort_columns.size());
+
+        for (auto col : m_sort_columns) {
+            Mixed value = obj.get_any(col);
+            if (!value.is_null() && value.is_type(type_String)) {
+                const StringData string = value.get_string();
+                auto& storage = m_last_value_storage.emplace_back(string.data(), string.size());
+                value = Mixed(StringData(storage.data(), storage.size()));
+            }
+            else if (!value.is_null() && value.is_type(type_Binary)) {
+                const BinaryData binary = value.get_binary();
+                auto& storage = m_last_value_storage.emplace_back(binary.data(), binary.size());
+                value = Mixed(BinaryData(storage.data(), storage.size()));
+            }
+            m_last_values.push_back(value);
+        }
+    }
+};
+
+} // namespace realm::binding
+
+extern "C" {
+
+REALM_EXPORT ResultsCursor* results_create_cursor(const Results& results, cursor_sort_clause* sort_clauses, size_t sort_clauses_count, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        results.get_realm()->verify_thread();
+
+        // Without sort clauses, the cursor walks the table and evaluates the query's conditions against each object,
+        // which ignores a restriction to a list, set or TableView. Only whole-table results can be paged.
+        const auto mode = results.get_mode();
+        if ((mode != Results::Mode::Table && mode != Results::Mode::Query) || !results.get_query().produces_results_in_table_order()) {
+            throw LogicError(ErrorCodes::IllegalOperation, "Only queries over all objects of a type can be paged by a cursor, not collections or their filtered results.");
+        }
+
+        // The cursor applies its own sort clauses to the query, so it can't honour the Results' sort, distinct or limit.
+        if (!results.get_descriptor_ordering().is_empty()) {
+            throw LogicError(ErrorCodes::IllegalOperation, "Sorted, distinct or limited results can't be paged by a cursor. Pass the sort clauses to the cursor instead.");
+        }
+
+        std::vector<ColKey> sort_columns;
+        std::vector<bool> ascending;
+        sort_columns.reserve(sort_clauses_count);
+        ascending.reserve(sort_clauses_count);
+
+        if (sort_clauses_count > 0) {
+            const auto& properties = results.get_object_schema().persisted_properties;
+            for (size_t i = 0; i < sort_clauses_count; ++i) {
+                const Property& property = properties.at(sort_clauses[i].property_index);
+                if (is_collection(property.type) || (property.type & ~PropertyType::Flags) == PropertyType::Object) {
+                    throw InvalidArgument(ErrorCodes::InvalidProperty, util::format("Cannot page by '%1' as it is not a primitive property.", property.name));
+                }
+
+                sort_columns.push_back(property.column_key);
+                ascending.push_back(sort_clauses[i].ascending);
+            }
+        }
+
+        return new ResultsCursor(results, std::move(sort_columns), std::move(ascending));
+    });
+}
+
+REALM_EXPORT void results_cursor_destroy(ResultsCursor* cursor)
+{
+    delete cursor;
+}
+
+REALM_EXPORT size_t results_cursor_next_page(ResultsCursor& cursor, realm_value_t* buffer, size_t buffer_size, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return cursor.next_page(buffer, buffer_size);
+    });
+}
+
+REALM_EXPORT void results_cursor_reset(ResultsCursor& cursor, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        cursor.reset();
+    });
+}
+
+}   // extern "C"
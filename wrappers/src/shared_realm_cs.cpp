@@ -33,10 +33,13 @@
 #include <realm/object-store/sync/app.hpp>
 #include <realm/sync/subscriptions.hpp>
 #include <realm/exceptions.hpp>
+#include <realm/util/file.hpp>
 #include <realm/util/logger.hpp>
 #include <realm/util/platform_info.hpp>
 
 #include <list>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 #include <sstream>
 
@@ -50,7 +53,6 @@ using RealmChangedT = void(void* managed_state_handle);
 using ReleaseGCHandleT = void(void* managed_handle);
 using LogMessageT = void(util::Logger::Level level, realm_string_t category_name, realm_string_t message);
 using MigrationCallbackT = void*(realm::SharedRealm* old_realm, realm::SharedRealm* new_realm, Schema* migration_schema, MarshaledVector<SchemaObject>, uint64_t schema_version, void* managed_migration_handle);
-using HandleTaskCompletionCallbackT = void(void* tcs_ptr, bool invoke_async, NativeException::Marshallable ex);
 using SharedSyncSession = std::shared_ptr<SyncSession>;
 using ErrorCallbackT = void(SharedSyncSession* session, realm_sync_error error, void* managed_sync_config);
 using ShouldCompactCallbackT = void*(void* managed_delegate, uint64_t total_size, uint64_t data_size, bool* should_compact);
@@ -73,6 +75,7 @@ namespace binding {
     std::function<ShouldCompactCallbackT> s_should_compact;
     std::function<HandleTaskCompletionCallbackT> s_handle_task_completion;
     std::function<DataInitializationCallbackT> s_initialize_data;
+    std::function<OperationProgressCallbackT> s_operation_progress;
 
     std::atomic<bool> s_can_call_managed;
 
@@ -102,6 +105,126 @@ namespace binding {
             s_log_message(level, to_capi(category.get_name()), to_capi(message));
         }
     };
+
+    // A contiguous column of values for shared_realm_bulk_create. `data` points to `int64_t`s or `double`s, or for
+    // strings to a blob of UTF-8 bytes in which the i-th value spans [offsets[i], offsets[i + 1]). If `null_bitmap`
+    // is set, the i-th value is null if bit (i % 8) of byte (i / 8) is set.
+    struct bulk_column {
+        size_t property_index;
+        realm_value_type type;
+        const void* data;
+        const size_t* offsets;
+        const uint8_t* null_bitmap;
+
+        bool is_null(size_t row) const
+        {
+            return null_bitmap && (null_bitmap[row / 8] & (1 << (row % 8)));
+        }
+
+        Mixed get(size_t row) const
+        {
+            if (is_null(row)) {
+                return Mixed();
+            }
+
+            switch (type) {
+                case realm_value_type::RLM_TYPE_INT:
+                    return Mixed(static_cast<const int64_t*>(data)[row]);
+                case realm_value_type::RLM_TYPE_DOUBLE:
+                    return Mixed(static_cast<const double*>(data)[row]);
+                case realm_value_type::RLM_TYPE_STRING:
+                    return Mixed(StringData(static_cast<const char*>(data) + offsets[row], offsets[row + 1] - offsets[row]));
+                default:
+                    REALM_UNREACHABLE();
+            }
+        }
+    };
+
+    std::chrono::microseconds get_slow_query_threshold(const SharedRealm& realm)
+    {
+        auto const& csharp_context = static_cast<CSharpBindingContext*>(realm->m_binding_context.get());
+        return csharp_context ? csharp_context->slow_query_threshold() : std::chrono::microseconds(0);
+    }
+
+    void report_query_duration(const SharedRealm& realm, const Query& query, std::chrono::nanoseconds duration)
+    {
+        const auto threshold = get_slow_query_threshold(realm);
+        if (threshold.count() == 0 || duration < threshold) {
+            return;
+        }
+
+        using milliseconds = std::chrono::duration<double, std::milli>;
+        static constexpr char message_format[] = "Query on '%1' took %2 ms, which exceeds the slow query threshold of %3 ms: %4";
+        Logger::get_default_logger()->log(Logger::Level::warn, message_format, query.get_table()->get_class_name(),
+            milliseconds(duration).count(), milliseconds(threshold).count(), query.get_description());
+    }
+
+    std::shared_ptr<TransactionMetrics> get_transaction_metrics(const SharedRealm& realm)
+    {
+        auto const& csharp_context = static_cast<CSharpBindingContext*>(realm->m_binding_context.get());
+        return csharp_context ? csharp_context->metrics() : nullptr;
+    }
+
+    // The time spent in each phase of shared_realm_open. Opening and mapping the file and validating or updating
+    // the schema all happen inside Realm::get_shared_realm, so they're reported together, excluding the time spent
+    // in the managed callbacks it invokes.
+    struct open_realm_timings {
+        uint64_t total_nanoseconds;
+        uint64_t file_and_schema_nanoseconds;
+        uint64_t should_compact_nanoseconds;
+        uint64_t migration_nanoseconds;
+        uint64_t initialization_nanoseconds;
+        uint64_t guid_fix_nanoseconds;
+        uint64_t initial_read_nanoseconds;
+    };
+
+    // The breakdown of the last shared_realm_open on this thread. Opens through shared_realm_open_async are recorded
+    // on their LocalOpenTask instead.
+    thread_local open_realm_timings s_last_open_timings;
+
+    uint64_t nanoseconds_since(std::chrono::steady_clock::time_point started)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count();
+    }
+
+    // Wraps the callbacks in `config` so that the time spent in them is added to `timings`. The timings are shared
+    // with the callbacks as the config outlives the open.
+    void time_open_callbacks(Realm::Config& config, const std::shared_ptr<open_realm_timings>& timings)
+    {
+        if (auto should_compact = std::move(config.should_compact_on_launch_function)) {
+            config.should_compact_on_launch_function = [timings, should_compact = std::move(should_compact)](uint64_t total_bytes, uint64_t used_bytes) {
+                const auto started = std::chrono::steady_clock::now();
+                const bool result = should_compact(total_bytes, used_bytes);
+                timings->should_compact_nanoseconds += nanoseconds_since(started);
+                return result;
+            };
+        }
+
+        if (auto migration = std::move(config.migration_function)) {
+            config.migration_function = [timings, migration = std::move(migration)](SharedRealm old_realm, SharedRealm new_realm, Schema& schema) {
+                const auto started = std::chrono::steady_clock::now();
+                migration(std::move(old_realm), std::move(new_realm), schema);
+                timings->migration_nanoseconds += nanoseconds_since(started);
+            };
+        }
+
+        if (auto initialization = std::move(config.initialization_function)) {
+            config.initialization_function = [timings, initialization = std::move(initialization)](SharedRealm realm) {
+                const auto started = std::chrono::steady_clock::now();
+                initialization(std::move(realm));
+                timings->initialization_nanoseconds += nanoseconds_since(started);
+            };
+        }
+    }
+
+    void log_open_timings(const std::string& path, const open_realm_timings& timings)
+    {
+        static constexpr char message_format[] = "Opened Realm at path %1 in %2 us (file and schema: %3 us, should compact: %4 us, migration: %5 us, initialization: %6 us, Guid check: %7 us, initial read: %8 us)";
+        Logger::get_default_logger()->log(Logger::Level::debug, message_format, path,
+            timings.total_nanoseconds / 1000, timings.file_and_schema_nanoseconds / 1000, timings.should_compact_nanoseconds / 1000,
+            timings.migration_nanoseconds / 1000, timings.initialization_nanoseconds / 1000, timings.guid_fix_nanoseconds / 1000,
+            timings.initial_read_nanoseconds / 1000);
+    }
 }
 
 Realm::Config get_shared_realm_config(Configuration configuration, std::optional<SyncConfiguration> sync_configuration = {})
@@ -255,9 +378,322 @@ inline SharedRealm* new_realm(SharedRealm realm)
     return new SharedRealm(realm);
 }
 
-extern void apply_guid_representation_fix(SharedRealm&, bool& found_non_v4_uuid, bool& found_guid_columns);
+extern void apply_guid_representation_fix(SharedRealm&, bool& found_non_v4_uuid, bool& found_guid_columns, const GuidFixProgressT& progress = nullptr);
 
 extern bool requires_guid_representation_fix(SharedRealm&);
+
+Realm::Config get_local_realm_config(Configuration configuration)
+{
+    Realm::Config config = get_shared_realm_config(configuration);
+    config.in_memory = configuration.in_memory;
+    config.automatically_handle_backlinks_in_migrations = configuration.automatically_migrate_embedded;
+
+    if (configuration.read_only) {
+        config.schema_mode = SchemaMode::Immutable;
+    } else if (configuration.delete_if_migration_needed) {
+        config.schema_mode = SchemaMode::SoftResetFile;
+    }
+
+    return config;
+}
+
+// Extends an existing Realm file to `size` bytes before it's opened, so that core maps it in one go instead of
+// remapping it repeatedly as it grows. Core treats the space past the data it has written as free space. New files are
+// left for core to create, and encrypted files are skipped as core has to lay out their pages itself.
+void preallocate_file(const Realm::Config& config, uint64_t size)
+{
+    if (size == 0 || config.in_memory || config.immutable() || !config.encryption_key.empty() || !util::File::exists(config.path)) {
+        return;
+    }
+
+    util::File file(config.path, util::File::mode_Update);
+    const auto current_size = static_cast<uint64_t>(file.get_size());
+
+    // An empty file is initialized by core, which requires it to still be empty.
+    if (current_size > 0 && current_size < size) {
+        file.prealloc(static_cast<size_t>(size));
+
+        static constexpr char message_format[] = "Preallocated Realm at path %1 from %2 to %3 bytes.";
+        Logger::get_default_logger()->log(Logger::Level::debug, message_format, config.path, current_size, size);
+    }
+}
+
+void fix_guid_representation(SharedRealm& realm, bool use_legacy_guid_representation, const GuidFixProgressT& progress)
+{
+    if (use_legacy_guid_representation || !requires_guid_representation_fix(realm)) {
+        return;
+    }
+
+    if (realm->config().immutable()) {
+        static constexpr char message_format[] = "Realm at path %1 may contain legacy Guid values but is opened as readonly so it cannot be migrated. This is only an issue if the file was created with Realm.NET prior to 10.10.0 and uses Guid properties. See the 10.10.0 release notes for more information.";
+        Logger::get_default_logger()->log(Logger::Level::warn, message_format, realm->config().path);
+        return;
+    }
+
+    bool found_non_v4_uuid = false;
+    bool found_guid_columns = false;
+    apply_guid_representation_fix(realm, found_non_v4_uuid, found_guid_columns, [&](uint64_t processed_objects, uint64_t total_objects) {
+        static constexpr char message_format[] = "Scanned %1 of %2 objects for legacy Guid values in Realm at path %3.";
+        Logger::get_default_logger()->log(Logger::Level::debug, message_format, processed_objects, total_objects, realm->config().path);
+        return !progress || progress(processed_objects, total_objects);
+    });
+
+    if (found_non_v4_uuid) {
+        static constexpr char message_format[] = "Realm at path %1 was found to contain Guid values in little-endian format and was automatically migrated to store them in big-endian format.";
+        Logger::get_default_logger()->log(Logger::Level::info, message_format, realm->config().path);
+    }
+    else if (found_guid_columns) {
+        static constexpr char message_format[] = "Realm at path %1 was not marked as having migrated its Guid values, but none of the values appeared to be in little-endian format. The Realm was marked as migrated, but the values have not been modified.";
+        Logger::get_default_logger()->log(Logger::Level::warn, message_format, realm->config().path);
+    }
+}
+
+// Opens the Realm and applies the Guid representation fix, adding the time spent in each phase but the initial read
+// to `timings`. `started` is when the open started, from which the file and schema time is derived.
+SharedRealm open_timed(Realm::Config config, bool use_legacy_guid_representation, uint64_t preallocate_size, const std::shared_ptr<open_realm_timings>& timings,
+    std::chrono::steady_clock::time_point started, const GuidFixProgressT& progress)
+{
+    time_open_callbacks(config, timings);
+
+    preallocate_file(config, preallocate_size);
+    auto realm = Realm::get_shared_realm(std::move(config));
+    timings->file_and_schema_nanoseconds = nanoseconds_since(started) - timings->should_compact_nanoseconds - timings->migration_nanoseconds - timings->initialization_nanoseconds;
+
+    const auto guid_fix_started = std::chrono::steady_clock::now();
+    fix_guid_representation(realm, use_legacy_guid_representation, progress);
+    timings->guid_fix_nanoseconds = nanoseconds_since(guid_fix_started);
+
+    return realm;
+}
+
+// Opens a local Realm on a background thread, so that compaction, migrations and the Guid representation fix don't
+// block the calling thread, and hands it back through s_open_realm_callback. Progress is reported to the managed
+// delegate at `managed_progress`, if any: before compaction and migration start, in bytes of the file, and while
+// scanning for legacy Guid values, in objects. Once cancel() returns, the callback is guaranteed not to be invoked.
+class LocalOpenTask : public std::enable_shared_from_this<LocalOpenTask> {
+public:
+    LocalOpenTask(void* task_completion_source, void* managed_progress)
+        : m_task_completion_source(task_completion_source)
+        , m_managed_progress(managed_progress)
+    {
+    }
+
+    void start(Realm::Config config, bool use_legacy_guid_representation, uint64_t preallocate_size)
+    {
+        // The Realm is handed over to the thread that awaits the open, so it must not be cached for the background thread.
+        config.cache = false;
+
+        std::weak_ptr<LocalOpenTask> weak_self = weak_from_this();
+        if (auto should_compact = std::move(config.should_compact_on_launch_function)) {
+            config.should_compact_on_launch_function = [weak_self, should_compact = std::move(should_compact)](uint64_t total_bytes, uint64_t used_bytes) {
+                const bool result = should_compact(total_bytes, used_bytes);
+                if (auto self = weak_self.lock(); self && result) {
+                    self->report_progress(0, 0, total_bytes);
+                }
+                return result;
+            };
+        }
+
+        if (auto migration = std::move(config.migration_function)) {
+            config.migration_function = [weak_self, migration = std::move(migration)](SharedRealm old_realm, SharedRealm new_realm, Schema& schema) {
+                if (auto self = weak_self.lock()) {
+                    self->report_progress(0, 0, 0);
+                }
+                migration(std::move(old_realm), std::move(new_realm), schema);
+            };
+        }
+
+        std::thread([self = shared_from_this(), config = std::move(config), use_legacy_guid_representation, preallocate_size]() mutable {
+            try {
+                self->throw_if_cancelled();
+
+                // A generic scheduler is bound to the thread that creates it, and opening the Realm verifies that it's
+                // used on that thread.
+                config.scheduler = util::Scheduler::make_generic();
+
+                // The progress callbacks are wrapped by the timing ones, so time spent reporting progress is counted
+                // towards the callback rather than the file and schema phase.
+                const auto started = std::chrono::steady_clock::now();
+                auto realm = open_timed(std::move(config), use_legacy_guid_representation, preallocate_size, self->m_timings, started, [&](uint64_t processed_objects, uint64_t) {
+                    self->report_progress(processed_objects, 0, 0);
+                    return true;
+                });
+
+                // The initial read happens when the reference is resolved on the awaiting thread, so it isn't included.
+                self->m_timings->total_nanoseconds = nanoseconds_since(started);
+                log_open_timings(realm->config().path, *self->m_timings);
+
+                self->complete(std::make_unique<ThreadSafeReference>(realm), { ErrorCodes::Error::OK });
+            }
+            catch (...) {
+                self->complete(nullptr, convert_exception().for_marshalling());
+            }
+        }).detach();
+    }
+
+    void cancel()
+    {
+        std::lock_guard lock(m_mutex);
+        m_cancelled = true;
+    }
+
+private:
+    void* m_task_completion_source;
+    void* m_managed_progress;
+    const std::chrono::steady_clock::time_point m_started = std::chrono::steady_clock::now();
+
+    // The phase breakdown of this open, shared with the timing callbacks, which are owned by the config.
+    const std::shared_ptr<open_realm_timings> m_timings = std::make_shared<open_realm_timings>();
+
+    // Recursive, as the progress callback may cancel the open.
+    std::recursive_mutex m_mutex;
+    bool m_cancelled = false;
+
+    void throw_if_cancelled()
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_cancelled) {
+            throw Exception(ErrorCodes::OperationAborted, "Opening the Realm was cancelled.");
+        }
+    }
+
+    // Throwing from the open callbacks aborts the open, rolling back any migration in progress. The lock is held while
+    // calling back into managed code, so that the progress delegate can be released once cancel() returns.
+    void report_progress(uint64_t processed_units, uint64_t processed_bytes, uint64_t total_bytes)
+    {
+        std::lock_guard lock(m_mutex);
+        throw_if_cancelled();
+
+        if (m_managed_progress) {
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_started;
+            if (!s_operation_progress(m_managed_progress, processed_units, processed_bytes, total_bytes, elapsed.count())) {
+                throw Exception(ErrorCodes::OperationAborted, "Opening the Realm was stopped by the progress callback.");
+            }
+        }
+    }
+
+    // The lock is held while calling back into managed code, so that cancel() can't return while the callback runs.
+    void complete(std::unique_ptr<ThreadSafeReference> reference, NativeException::Marshallable ex)
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_cancelled) {
+            s_open_realm_callback(m_task_completion_source, reference.release(), std::move(ex));
+        }
+    }
+};
+
+struct compaction_result {
+    uint64_t size_before;
+    uint64_t size_after;
+    double elapsed_seconds;
+    bool compacted;
+};
+
+// Compacts a Realm file on a background thread and completes the task at `task_completion_source` through
+// s_handle_task_completion, after which the outcome can be read with result(). The Realm is opened without a schema,
+// so no migration or initialization callbacks run, and like Realm::compact() it must not be open anywhere else.
+// Progress is reported before and after compacting, in bytes of the file, as core doesn't report progress while
+// copying. Once cancel() returns, the task is guaranteed not to be completed, but a compaction that already
+// started runs to the end.
+class CompactTask : public std::enable_shared_from_this<CompactTask> {
+public:
+    CompactTask(void* task_completion_source, void* managed_progress)
+        : m_task_completion_source(task_completion_source)
+        , m_managed_progress(managed_progress)
+    {
+    }
+
+    void start(Realm::Config config)
+    {
+        config.cache = false;
+        config.schema.reset();
+        config.schema_version = ObjectStore::NotVersioned;
+        config.migration_function = nullptr;
+        config.initialization_function = nullptr;
+        config.should_compact_on_launch_function = nullptr;
+
+        std::thread([self = shared_from_this(), config = std::move(config)]() mutable {
+            try {
+                // A generic scheduler is bound to the thread that creates it, and compact() verifies that it's used on
+                // that thread.
+                config.scheduler = util::Scheduler::make_generic();
+
+                const auto path = config.path;
+                auto realm = Realm::get_shared_realm(std::move(config));
+
+                compaction_result result{};
+                result.size_before = util::File::get_size_static(path);
+                if (!self->report_progress(0, result.size_before)) {
+                    throw Exception(ErrorCodes::OperationAborted, "Compacting the Realm was stopped by the progress callback.");
+                }
+
+                result.compacted = realm->compact();
+                realm->close();
+
+                result.size_after = util::File::get_size_static(path);
+                self->report_progress(result.size_before, result.size_before);
+                result.elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - self->m_started).count();
+
+                if (result.compacted) {
+                    static constexpr char message_format[] = "Compacted Realm at path %1 from %2 to %3 bytes in %4 ms.";
+                    Logger::get_default_logger()->log(Logger::Level::info, message_format, path, result.size_before, result.size_after, static_cast<uint64_t>(result.elapsed_seconds * 1000));
+                }
+
+                self->complete(result, { ErrorCodes::Error::OK });
+            }
+            catch (...) {
+                self->complete({}, convert_exception().for_marshalling());
+            }
+        }).detach();
+    }
+
+    void cancel()
+    {
+        std::lock_guard lock(m_mutex);
+        m_cancelled = true;
+    }
+
+    compaction_result result()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_result;
+    }
+
+private:
+    void* m_task_completion_source;
+    void* m_managed_progress;
+    const std::chrono::steady_clock::time_point m_started = std::chrono::steady_clock::now();
+
+    std::recursive_mutex m_mutex;
+    bool m_cancelled = false;
+    compaction_result m_result{};
+
+    // Returns false if the managed callback asked to stop. The lock is held while calling back into managed code, so
+    // that the progress delegate can be released once cancel() returns. It's recursive, as the callback may cancel.
+    bool report_progress(uint64_t processed_bytes, uint64_t total_bytes)
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_cancelled) {
+            throw Exception(ErrorCodes::OperationAborted, "Compacting the Realm was cancelled.");
+        }
+
+        if (!m_managed_progress) {
+            return true;
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_started;
+        return s_operation_progress(m_managed_progress, 0, processed_bytes, total_bytes, elapsed.count()) && !m_cancelled;
+    }
+
+    void complete(compaction_result result, NativeException::Marshallable ex)
+    {
+        std::lock_guard lock(m_mutex);
+        m_result = result;
+        if (!m_cancelled) {
+            s_handle_task_completion(m_task_completion_source, /* invoke_async */ false, std::move(ex));
+        }
+    }
+};
 }
 
 extern "C" {
@@ -275,7 +711,8 @@ REALM_EXPORT void shared_realm_install_callbacks(
     MigrationCallbackT* on_migration,
     ShouldCompactCallbackT* should_compact,
     HandleTaskCompletionCallbackT* handle_task_completion,
-    DataInitializationCallbackT* initialize_data)
+    DataInitializationCallbackT* initialize_data,
+    OperationProgressCallbackT* operation_progress)
 {
     s_realm_changed = wrap_managed_callback(realm_changed);
     s_get_native_schema = wrap_managed_callback(get_schema);
@@ -288,6 +725,7 @@ REALM_EXPORT void shared_realm_install_callbacks(
     s_should_compact = wrap_managed_callback(should_compact);
     s_handle_task_completion = wrap_managed_callback(handle_task_completion);
     s_initialize_data = wrap_managed_callback(initialize_data);
+    s_operation_progress = wrap_managed_callback(operation_progress);
 
     realm::binding::s_can_call_managed = true;
 
@@ -325,40 +763,84 @@ REALM_EXPORT TypeErasedMarshaledVector shared_realm_get_log_category_names() {
 REALM_EXPORT SharedRealm* shared_realm_open(Configuration configuration, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        Realm::Config config = get_shared_realm_config(configuration);
-        config.in_memory = configuration.in_memory;
-        config.automatically_handle_backlinks_in_migrations = configuration.automatically_migrate_embedded;
+        Realm::Config config = get_local_realm_config(configuration);
 
-        if (configuration.read_only) {
-            config.schema_mode = SchemaMode::Immutable;
-        } else if (configuration.delete_if_migration_needed) {
-            config.schema_mode = SchemaMode::SoftResetFile;
-        }
+        const auto started = std::chrono::steady_clock::now();
+        auto timings = std::make_shared<open_realm_timings>();
+        auto realm = open_timed(std::move(config), configuration.use_legacy_guid_representation, configuration.preallocate_size, timings, started, nullptr);
 
-        auto realm = Realm::get_shared_realm(std::move(config));
-        if (!configuration.use_legacy_guid_representation && requires_guid_representation_fix(realm)) {
-            if (configuration.read_only) {
-                static constexpr char message_format[] = "Realm at path %1 may contain legacy Guid values but is opened as readonly so it cannot be migrated. This is only an issue if the file was created with Realm.NET prior to 10.10.0 and uses Guid properties. See the 10.10.0 release notes for more information.";
-                Logger::get_default_logger()->log(Logger::Level::warn, message_format, realm->config().path);
-            }
-            else {
-                bool found_non_v4_uuid = false;
-                bool found_guid_columns = false;
-                apply_guid_representation_fix(realm, found_non_v4_uuid, found_guid_columns);
-                if (found_non_v4_uuid) {
-                    static constexpr char message_format[] = "Realm at path %1 was found to contain Guid values in little-endian format and was automatically migrated to store them in big-endian format.";
-                    Logger::get_default_logger()->log(Logger::Level::info, message_format, realm->config().path);
-                }
-                else if (found_guid_columns) {
-                    static constexpr char message_format[] = "Realm at path %1 was not marked as having migrated its Guid values, but none of the values appeared to be in little-endian format. The Realm was marked as migrated, but the values have not been modified.";
-                    Logger::get_default_logger()->log(Logger::Level::warn, message_format, realm->config().path);
-                }
-            }
-        }
-        return new_realm(std::move(realm));
+        const auto initial_read_started = std::chrono::steady_clock::now();
+        auto result = new_realm(std::move(realm));
+        timings->initial_read_nanoseconds = nanoseconds_since(initial_read_started);
+        timings->total_nanoseconds = nanoseconds_since(started);
+        s_last_open_timings = *timings;
+        log_open_timings((*result)->config().path, *timings);
+
+        return result;
+    });
+}
+
+// Opens a local Realm on a background thread. The Realm is handed back as a ThreadSafeReference through the open callback
+// with `task_completion_source`, or the error if opening it failed. `managed_progress` may be null.
+REALM_EXPORT std::shared_ptr<LocalOpenTask>* shared_realm_open_async(Configuration configuration, void* task_completion_source, void* managed_progress, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        auto task = std::make_shared<LocalOpenTask>(task_completion_source, managed_progress);
+        task->start(get_local_realm_config(configuration), configuration.use_legacy_guid_representation, configuration.preallocate_size);
+        return new std::shared_ptr<LocalOpenTask>(std::move(task));
+    });
+}
+
+// Stops the open at the next opportunity. The open callback won't be invoked once this returns.
+REALM_EXPORT void shared_realm_open_async_cancel(std::shared_ptr<LocalOpenTask>& task, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        task->cancel();
+    });
+}
+
+REALM_EXPORT void shared_realm_open_async_destroy(std::shared_ptr<LocalOpenTask>* task)
+{
+    delete task;
+}
+
+// Compacts the Realm described by `configuration` on a background thread, see CompactTask.
+REALM_EXPORT std::shared_ptr<CompactTask>* shared_realm_compact_async(Configuration configuration, void* task_completion_source, void* managed_progress, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        auto task = std::make_shared<CompactTask>(task_completion_source, managed_progress);
+        task->start(get_local_realm_config(configuration));
+        return new std::shared_ptr<CompactTask>(std::move(task));
+    });
+}
+
+// Stops the compaction if it hasn't started yet. The task won't be completed once this returns.
+REALM_EXPORT void shared_realm_compact_async_cancel(std::shared_ptr<CompactTask>& task, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        task->cancel();
     });
 }
 
+// Only valid once the task has been completed successfully.
+REALM_EXPORT void shared_realm_compact_async_get_result(std::shared_ptr<CompactTask>& task, compaction_result* result, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        *result = task->result();
+    });
+}
+
+REALM_EXPORT void shared_realm_compact_async_destroy(std::shared_ptr<CompactTask>* task)
+{
+    delete task;
+}
+
+// Copies the phase breakdown of the last shared_realm_open on the calling thread to `timings`.
+REALM_EXPORT void shared_realm_get_last_open_timings(open_realm_timings* timings)
+{
+    *timings = s_last_open_timings;
+}
+
 REALM_EXPORT SharedAsyncOpenTask* shared_realm_open_with_sync_async(Configuration configuration, SyncConfiguration sync_configuration, void* task_completion_source, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
@@ -469,7 +951,14 @@ REALM_EXPORT uint32_t shared_realm_begin_transaction_async(SharedRealm& realm, v
     return handle_errors(ex, [&]() {
         // notify_only is always set to true since we implement WriteAsync in terms of BeginWriteAsync and CommitAsync.
         // Because of this, we never end the delegate passed to WriteAsync with the commit call.
-        return realm->async_begin_transaction([tcs_ptr]() {
+        auto metrics = get_transaction_metrics(realm);
+        const auto started = metrics ? TransactionMetrics::Clock::now() : TransactionMetrics::Clock::time_point();
+        return realm->async_begin_transaction([tcs_ptr, metrics = std::move(metrics), started]() {
+            if (metrics) {
+                metrics->write_lock_wait.record(TransactionMetrics::Clock::now() - started);
+                metrics->transaction_started();
+            }
+
             // s_handle_task_completion is a generic callback that always expects an exception as one of the params.
             // However, in this specific case, async_begin_transaction never throws, hence the need for a NoError nativeEx.
             NativeException::Marshallable nativeEx{ ErrorCodes::Error::OK };
@@ -478,16 +967,27 @@ REALM_EXPORT uint32_t shared_realm_begin_transaction_async(SharedRealm& realm, v
     });
 }
 
-REALM_EXPORT uint32_t shared_realm_commit_transaction_async(SharedRealm& realm, void* tcs_ptr, NativeException::Marshallable& ex)
+REALM_EXPORT uint32_t shared_realm_commit_transaction_async(SharedRealm& realm, void* tcs_ptr, bool allow_grouping, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return realm->async_commit_transaction([tcs_ptr](std::exception_ptr err) {
+        auto metrics = get_transaction_metrics(realm);
+        if (metrics) {
+            metrics->transaction_ended();
+        }
+
+        // The commit duration includes the time spent waiting for grouped commits to be flushed to disk.
+        const auto started = metrics ? TransactionMetrics::Clock::now() : TransactionMetrics::Clock::time_point();
+        return realm->async_commit_transaction([tcs_ptr, metrics = std::move(metrics), started](std::exception_ptr err) {
+            if (metrics) {
+                metrics->commit.record(TransactionMetrics::Clock::now() - started);
+            }
+
             NativeException::Marshallable nativeEx{ ErrorCodes::Error::OK };
             if (err) {
                 nativeEx = convert_exception(err).for_marshalling();
             }
             s_handle_task_completion(tcs_ptr, /* invoke_async */ true, nativeEx);
-        }, /* allow_grouping */ false);
+        }, allow_grouping);
     });
 }
 
@@ -501,20 +1001,43 @@ REALM_EXPORT bool shared_realm_cancel_async_transaction(SharedRealm& realm, uint
 REALM_EXPORT void shared_realm_begin_transaction(SharedRealm& realm, NativeException::Marshallable& ex)
 {
     handle_errors(ex, [&]() {
+        auto metrics = get_transaction_metrics(realm);
+        if (!metrics) {
+            realm->begin_transaction();
+            return;
+        }
+
+        // Beginning a write transaction is dominated by acquiring the write lock.
+        const auto started = TransactionMetrics::Clock::now();
         realm->begin_transaction();
+        metrics->write_lock_wait.record(TransactionMetrics::Clock::now() - started);
+        metrics->transaction_started();
     });
 }
 
 REALM_EXPORT void shared_realm_commit_transaction(SharedRealm& realm, NativeException::Marshallable& ex)
 {
     handle_errors(ex, [&]() {
+        auto metrics = get_transaction_metrics(realm);
+        if (!metrics) {
+            realm->commit_transaction();
+            return;
+        }
+
+        metrics->transaction_ended();
+        const auto started = TransactionMetrics::Clock::now();
         realm->commit_transaction();
+        metrics->commit.record(TransactionMetrics::Clock::now() - started);
     });
 }
 
 REALM_EXPORT void shared_realm_cancel_transaction(SharedRealm& realm, NativeException::Marshallable& ex)
 {
     handle_errors(ex, [&]() {
+        if (auto metrics = get_transaction_metrics(realm)) {
+            metrics->transaction_ended();
+        }
+
         realm->cancel_transaction();
     });
 }
@@ -538,7 +1061,15 @@ REALM_EXPORT bool shared_realm_is_same_instance(SharedRealm& lhs, SharedRealm& r
 REALM_EXPORT bool shared_realm_refresh(SharedRealm& realm, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return realm->refresh();
+        auto metrics = get_transaction_metrics(realm);
+        if (!metrics) {
+            return realm->refresh();
+        }
+
+        const auto started = TransactionMetrics::Clock::now();
+        const bool refreshed = realm->refresh();
+        metrics->refresh.record(TransactionMetrics::Clock::now() - started);
+        return refreshed;
     });
 }
 
@@ -549,14 +1080,6 @@ REALM_EXPORT bool shared_realm_compact(SharedRealm& realm, NativeException::Mars
     });
 }
 
-enum class ThreadSafeReferenceType : uint8_t {
-    Object = 0,
-    List,
-    Results,
-    Set,
-    Dictionary
-};
-
 REALM_EXPORT void* shared_realm_resolve_reference(SharedRealm& realm, ThreadSafeReference& reference, ThreadSafeReferenceType type, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]()-> void*{
@@ -618,6 +1141,92 @@ REALM_EXPORT Object* shared_realm_create_object(SharedRealm& realm, TableKey tab
     });
 }
 
+// Creates `count` objects and fills the given properties from contiguous typed columns. If the table has a primary key,
+// it must be one of the columns. Objects are created in the current write transaction and no handles are returned.
+REALM_EXPORT void shared_realm_bulk_create(SharedRealm& realm, TableKey table_key, size_t count, bulk_column* columns, size_t columns_count, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        realm->verify_in_write();
+
+        const TableRef table = get_table(realm, table_key);
+        const ObjectSchema& object_schema = *realm->schema().find(table_key);
+
+        const bulk_column* primary_key_column = nullptr;
+        std::vector<std::pair<const bulk_column*, ColKey>> value_columns;
+        value_columns.reserve(columns_count);
+
+        for (size_t i = 0; i < columns_count; ++i) {
+            const bulk_column& column = columns[i];
+            const Property& property = object_schema.persisted_properties.at(column.property_index);
+
+            if (column.type != realm_value_type::RLM_TYPE_INT && column.type != realm_value_type::RLM_TYPE_DOUBLE && column.type != realm_value_type::RLM_TYPE_STRING) {
+                throw InvalidArgument(ErrorCodes::InvalidArgument, util::format("Columns of type %1 are not supported by bulk create.", to_string(column.type)));
+            }
+
+            if (is_collection(property.type) || to_capi(property.type) != column.type) {
+                throw PropertyTypeMismatchException(object_schema.name, property.name, to_string(property.type), to_string(column.type));
+            }
+
+            if (column.null_bitmap && !is_nullable(property.type)) {
+                for (size_t row = 0; row < count; ++row) {
+                    if (column.is_null(row)) {
+                        throw NotNullable(object_schema.name, property.name);
+                    }
+                }
+            }
+
+            if (property.is_primary) {
+                primary_key_column = &column;
+            }
+            else {
+                value_columns.emplace_back(&column, property.column_key);
+            }
+        }
+
+        if (!object_schema.primary_key.empty() && !primary_key_column) {
+            throw InvalidArgument(ErrorCodes::MissingValue, util::format("Objects of type '%1' can't be created without a value for the primary key '%2'.", object_schema.name, object_schema.primary_key));
+        }
+
+        for (size_t row = 0; row < count; ++row) {
+            Obj obj;
+            if (primary_key_column) {
+                // create_object_with_primary_key returns the existing object for a duplicate primary key, which
+                // would then be overwritten, so duplicates fail like they do in shared_realm_create_object_unique.
+                const Mixed primary_key = primary_key_column->get(row);
+                bool did_create = false;
+                obj = table->create_object_with_primary_key(primary_key, &did_create);
+                if (!did_create) {
+                    std::ostringstream string_builder;
+                    string_builder << primary_key;
+                    throw SetDuplicatePrimaryKeyValueException(object_schema.name, object_schema.primary_key, string_builder.str());
+                }
+            }
+            else {
+                obj = table->create_object();
+            }
+
+            for (const auto& [column, column_key] : value_columns) {
+                if (column->is_null(row)) {
+                    obj.set_null(column_key);
+                    continue;
+                }
+
+                switch (column->type) {
+                    case realm_value_type::RLM_TYPE_INT:
+                        obj.set<Int>(column_key, static_cast<const int64_t*>(column->data)[row]);
+                        break;
+                    case realm_value_type::RLM_TYPE_DOUBLE:
+                        obj.set<Double>(column_key, static_cast<const double*>(column->data)[row]);
+                        break;
+                    default:
+                        obj.set<String>(column_key, column->get(row).get_string());
+                        break;
+                }
+            }
+        }
+    });
+}
+
 REALM_EXPORT Object* shared_realm_create_object_unique(const SharedRealm& realm, TableKey table_key, realm_value_t primitive, bool try_update, bool& is_new, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
@@ -681,6 +1290,89 @@ REALM_EXPORT SharedRealm* shared_realm_freeze(const SharedRealm& realm, NativeEx
     });
 }
 
+// Creates or updates `count` objects identified by their primary keys and sets the given properties on them. `values`
+// holds `count * properties_count` values, laid out row by row or, if `columnar` is set, property by property.
+// Properties of existing objects are only written if their value has changed. `is_new` receives for every row
+// whether its object was created.
+REALM_EXPORT void shared_realm_upsert_objects(SharedRealm& realm, TableKey table_key, realm_value_t* primary_keys, size_t count,
+    size_t* property_indices, size_t properties_count, realm_value_t* values, bool columnar, bool* is_new, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        realm->verify_in_write();
+
+        const TableRef table = get_table(realm, table_key);
+        const ObjectSchema& object_schema = *realm->schema().find(table_key);
+        if (object_schema.primary_key.empty()) {
+            throw MissingPrimaryKeyException(object_schema.name);
+        }
+
+        const Property& primary_key_property = *object_schema.primary_key_property();
+        const realm_value_type primary_key_type = to_capi(primary_key_property.type);
+
+        std::vector<const Property*> properties;
+        properties.reserve(properties_count);
+        for (size_t i = 0; i < properties_count; ++i) {
+            const Property& property = object_schema.persisted_properties.at(property_indices[i]);
+            if (is_collection(property.type) || property.is_primary) {
+                throw InvalidArgument(ErrorCodes::InvalidProperty, util::format("Property '%1.%2' cannot be set in a batch upsert.", object_schema.name, property.name));
+            }
+            properties.push_back(&property);
+        }
+
+        for (size_t row = 0; row < count; ++row) {
+            const realm_value_t& primary_key = primary_keys[row];
+            if (primary_key.is_null() && !primary_key_property.type_is_nullable()) {
+                throw NotNullable(object_schema.name, primary_key_property.name);
+            }
+
+            if (!primary_key.is_null() && primary_key.type != primary_key_type) {
+                throw PropertyTypeMismatchException(object_schema.name, primary_key_property.name, to_string(primary_key_property.type), to_string(primary_key.type));
+            }
+
+            const Mixed key = from_capi(primary_key);
+            Obj obj;
+            if (const ObjKey obj_key = table->find_first(primary_key_property.column_key, key)) {
+                obj = table->get_object(obj_key);
+                is_new[row] = false;
+            }
+            else {
+                obj = table->create_object_with_primary_key(key);
+                is_new[row] = true;
+            }
+
+            for (size_t i = 0; i < properties_count; ++i) {
+                const Property& property = *properties[i];
+                const realm_value_t& value = columnar ? values[i * count + row] : values[row * properties_count + i];
+                const bool is_mixed = (property.type & ~PropertyType::Flags) == PropertyType::Mixed;
+
+                if (value.is_null() && !is_nullable(property.type)) {
+                    throw NotNullable(object_schema.name, property.name);
+                }
+
+                if (!value.is_null() && !is_mixed && to_capi(property.type) != value.type) {
+                    throw PropertyTypeMismatchException(object_schema.name, property.name, to_string(property.type), to_string(value.type));
+                }
+
+                if (value.type == realm_value_type::RLM_TYPE_LINK && !is_mixed) {
+                    const ObjKey target_key = value.link.object->get_obj().get_key();
+                    if (is_new[row] || obj.get<ObjKey>(property.column_key) != target_key) {
+                        obj.set(property.column_key, target_key);
+                    }
+                    continue;
+                }
+
+                const Mixed new_value = value.type == realm_value_type::RLM_TYPE_LINK
+                    ? Mixed(ObjLink(value.link.object->get_object_schema().table_key, value.link.object->get_obj().get_key()))
+                    : from_capi(value);
+
+                if (is_new[row] || obj.get_any(property.column_key) != new_value) {
+                    obj.set_any(property.column_key, new_value);
+                }
+            }
+        }
+    });
+}
+
 REALM_EXPORT Object* shared_realm_get_object_for_primary_key(SharedRealm& realm, TableKey table_key, realm_value_t primitive, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() -> Object* {
@@ -716,6 +1408,61 @@ REALM_EXPORT Object* shared_realm_get_object_for_primary_key(SharedRealm& realm,
     });
 }
 
+// Looks up many objects by primary key in one go. The keys are looked up in sorted order so that consecutive
+// lookups hit neighbouring parts of the primary key index, and misses are reported as null entries in `objects`.
+REALM_EXPORT void shared_realm_get_objects_for_primary_keys(SharedRealm& realm, TableKey table_key, realm_value_t* primitives, size_t count, Object** objects, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        realm->verify_thread();
+
+        std::fill(objects, objects + count, nullptr);
+
+        if (table_key == TableKey() || count == 0) {
+            return;
+        }
+
+        const TableRef table = get_table(realm, table_key);
+        const ObjectSchema& object_schema = *realm->schema().find(table_key);
+        if (object_schema.primary_key.empty()) {
+            const std::string name(ObjectStore::object_type_for_table_name(table->get_name()));
+            throw MissingPrimaryKeyException(name);
+        }
+
+        const Property& primary_key_property = *object_schema.primary_key_property();
+        const bool is_nullable = primary_key_property.type_is_nullable();
+        const realm_value_type primary_key_type = to_capi(primary_key_property.type);
+
+        std::vector<std::pair<Mixed, size_t>> keys;
+        keys.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const realm_value_t& primitive = primitives[i];
+            if (primitive.is_null()) {
+                if (is_nullable) {
+                    keys.emplace_back(Mixed(), i);
+                }
+                continue;
+            }
+
+            if (primitive.type != primary_key_type) {
+                throw PropertyTypeMismatchException(object_schema.name, primary_key_property.name, to_string(primary_key_property.type), to_string(primitive.type));
+            }
+
+            keys.emplace_back(from_capi(primitive), i);
+        }
+
+        std::sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+
+        const ColKey column_key = primary_key_property.column_key;
+        for (const auto& [key, index] : keys) {
+            if (const ObjKey obj_key = table->find_first(column_key, key)) {
+                objects[index] = new Object(realm, object_schema, table->get_object(obj_key));
+            }
+        }
+    });
+}
+
 REALM_EXPORT Object* shared_realm_get_object_for_object(SharedRealm& realm, Object& object, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() -> Object* {
@@ -843,6 +1590,68 @@ REALM_EXPORT bool shared_realm_refresh_async(SharedRealm& realm, void* managed_t
     });
 }
 
+// Returns the version of the transaction the Realm is currently reading, or, after a commit, the version it created.
+REALM_EXPORT uint64_t shared_realm_get_transaction_version(SharedRealm& realm, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() -> uint64_t {
+        const util::Optional<VersionID> current_version = realm->current_transaction_version();
+        return current_version ? (*current_version).version : 0;
+    });
+}
+
+// Registers `managed_tcs` to be completed once the Realm has advanced to `version` or later. Returns false without
+// registering if it already has, in which case the caller completes the task itself.
+REALM_EXPORT bool shared_realm_wait_for_version_async(SharedRealm& realm, uint64_t version, void* managed_tcs, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        if (realm->is_frozen()) {
+            throw LogicError(ErrorCodes::WrongTransactionState, "A frozen Realm can't advance to a different version.");
+        }
+
+        const util::Optional<VersionID> current_version = realm->current_transaction_version();
+        if (current_version && version <= (*current_version).version) {
+            return false;
+        }
+
+        auto const& csharp_context = static_cast<CSharpBindingContext*>(realm->m_binding_context.get());
+        csharp_context->pending_refresh_callbacks().add(version, managed_tcs);
+
+        return true;
+    });
+}
+
+REALM_EXPORT void shared_realm_set_slow_query_threshold(SharedRealm& realm, uint64_t threshold_us, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        auto const& csharp_context = static_cast<CSharpBindingContext*>(realm->m_binding_context.get());
+        REALM_ASSERT(csharp_context != nullptr);
+        csharp_context->set_slow_query_threshold(std::chrono::microseconds(threshold_us));
+    });
+}
+
+REALM_EXPORT void shared_realm_set_metrics_enabled(SharedRealm& realm, bool enabled, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        auto const& csharp_context = static_cast<CSharpBindingContext*>(realm->m_binding_context.get());
+        REALM_ASSERT(csharp_context != nullptr);
+        csharp_context->set_metrics_enabled(enabled);
+    });
+}
+
+// Returns false if metrics aren't enabled for the Realm, in which case `metrics` is left untouched.
+REALM_EXPORT bool shared_realm_get_metrics(SharedRealm& realm, transaction_metrics* metrics, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        auto transaction_metrics = get_transaction_metrics(realm);
+        if (!transaction_metrics) {
+            return false;
+        }
+
+        *metrics = transaction_metrics->summarize();
+        return true;
+    });
+}
+
 REALM_EXPORT size_t shared_realm_get_operating_system(uint16_t* buffer, size_t buffer_length)
 {
     std::string platform = realm::util::get_library_platform();
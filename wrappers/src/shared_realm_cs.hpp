@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "metrics_cs.hpp"
 #include "schema_cs.hpp"
 #include "sync_session_cs.hpp"
 
@@ -29,6 +30,10 @@
 #include <realm/sync/config.hpp>
 #include <realm/object-store/sync/app_user.hpp>
 
+#include <chrono>
+#include <queue>
+#include <tuple>
+
 namespace realm::binding {
 using SharedSyncUser = std::shared_ptr<app::User>;
 
@@ -43,6 +48,8 @@ struct Configuration
 
     uint64_t max_number_of_active_versions;
 
+    uint64_t preallocate_size;
+
     void* managed_config;
 
     MarshaledVector<uint8_t> encryption_key;
@@ -88,9 +95,27 @@ inline const TableRef get_table(const SharedRealm& realm, TableKey table_key)
 {
     return realm->read_group().get_table(table_key);
 }
+
+enum class ThreadSafeReferenceType : uint8_t {
+    Object = 0,
+    List,
+    Results,
+    Set,
+    Dictionary
+};
     
 extern std::function<void(void*)> s_release_gchandle;
 
+// Reports the progress of a long running native operation to the managed delegate behind `managed_progress`.
+// Returning false asks the operation to stop at the next opportunity.
+using OperationProgressCallbackT = bool(void* managed_progress, uint64_t processed_units, uint64_t processed_bytes, uint64_t total_bytes, double elapsed_seconds);
+extern std::function<OperationProgressCallbackT> s_operation_progress;
+
+// Completes the managed TaskCompletionSource behind `tcs_ptr`, failing it if `ex` holds an error. If `invoke_async` is set,
+// the result is posted on the current SynchronizationContext, so it may only be set on threads that have one.
+using HandleTaskCompletionCallbackT = void(void* tcs_ptr, bool invoke_async, NativeException::Marshallable ex);
+extern std::function<HandleTaskCompletionCallbackT> s_handle_task_completion;
+
 struct GCHandleHolder {
 public:
     GCHandleHolder(void* handle)
@@ -122,41 +147,41 @@ private:
     void* m_handle;
 };
 
+// Task completion sources waiting for the Realm to advance to a version, ordered by that version so that
+// completing the waiters satisfied by a new version doesn't need to visit the others.
 class TcsRegistryWithVersion {
 public:
-    uint64_t add(DB::version_type version, void* tcs)
+    void add(DB::version_type version, void* tcs)
     {
-        uint64_t token = m_next_token++;
-        m_tcs.emplace_hint(m_tcs.end(), token, std::make_pair(version, tcs));
-        return token;
-    }
-
-    void remove(uint64_t token)
-    {
-        m_tcs.erase(token);
+        m_tcs.push({ version, m_next_sequence++, tcs });
     }
 
+    // Returns the waiters for `version` or earlier, in the order they were added for the same version.
     std::vector<void*> remove_for_version(DB::version_type version)
     {
-        std::vector<uint64_t> tokens;
         std::vector<void*> tcs_vector;
-
-        for (const auto& [token, request] : m_tcs) {
-            if (auto& [expected, tcs] = request; expected <= version) {
-                tcs_vector.push_back(tcs);
-                tokens.push_back(token);
-            }
-        }
-        for (const auto& token : tokens) {
-            remove(token);
+        while (!m_tcs.empty() && m_tcs.top().version <= version) {
+            tcs_vector.push_back(m_tcs.top().tcs);
+            m_tcs.pop();
         }
 
         return tcs_vector;
     }
 
 private:
-    std::map<uint64_t, std::pair<uint64_t, void*>> m_tcs;
-    uint64_t m_next_token = 0;
+    struct Waiter {
+        DB::version_type version;
+        uint64_t sequence;
+        void* tcs;
+
+        bool operator>(const Waiter& other) const
+        {
+            return std::tie(version, sequence) > std::tie(other.version, other.sequence);
+        }
+    };
+
+    std::priority_queue<Waiter, std::vector<Waiter>, std::greater<Waiter>> m_tcs;
+    uint64_t m_next_sequence = 0;
 };
 
 class CSharpBindingContext : public BindingContext {
@@ -174,13 +199,54 @@ public:
         return m_pending_refresh_callbacks;
     }
 
+    std::chrono::microseconds slow_query_threshold() const
+    {
+        return m_slow_query_threshold;
+    }
+
+    void set_slow_query_threshold(std::chrono::microseconds threshold)
+    {
+        m_slow_query_threshold = threshold;
+    }
+
+    // Null unless transaction metrics were enabled for the Realm. Shared so that async transaction callbacks
+    // can record into it after metrics have been disabled again.
+    const std::shared_ptr<TransactionMetrics>& metrics() const
+    {
+        return m_metrics;
+    }
+
+    void set_metrics_enabled(bool enabled)
+    {
+        if (!enabled) {
+            m_metrics.reset();
+        }
+        else if (!m_metrics) {
+            m_metrics = std::make_shared<TransactionMetrics>();
+        }
+    }
+
     // TODO: this should go away once https://github.com/realm/realm-core/issues/4584 is resolved
     Schema m_realm_schema;
 
 private:
     GCHandleHolder m_managed_state_handle;
     TcsRegistryWithVersion m_pending_refresh_callbacks;
+    std::chrono::microseconds m_slow_query_threshold{0};
+    std::shared_ptr<TransactionMetrics> m_metrics;
 };
 
+// The slow query threshold set for the Realm, or zero if slow queries aren't logged. Callers check this before timing
+// a query so that queries aren't timed or copied when logging is disabled.
+std::chrono::microseconds get_slow_query_threshold(const SharedRealm& realm);
+
+// Logs a warning if a query evaluation took longer than the slow query threshold set for the Realm.
+void report_query_duration(const SharedRealm& realm, const Query& query, std::chrono::nanoseconds duration);
+
+// Reports how many objects the Guid representation fix has scanned out of `total_objects`. The fix scans the file
+// once to look for legacy values and, if it finds any, a second time to collect them, so the count restarts for
+// the second pass. Returning false cancels the fix.
+using GuidFixProgressT = std::function<bool(uint64_t processed_objects, uint64_t total_objects)>;
+
 } // namespace realm::binding
 
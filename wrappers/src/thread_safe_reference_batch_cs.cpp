@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm.hpp>
+#include <realm/object-store/dictionary.hpp>
+#include <realm/object-store/list.hpp>
+#include <realm/object-store/object.hpp>
+#include <realm/object-store/results.hpp>
+#include <realm/object-store/set.hpp>
+#include <realm/object-store/shared_realm.hpp>
+
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+#include <variant>
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace {
+
+using FrozenValue = std::variant<Object, List, Results, object_store::Set, object_store::Dictionary>;
+
+// Imports each of the `count` live values, described by `types`, into the frozen `realm`.
+std::vector<FrozenValue> freeze_values(const SharedRealm& realm, void* const* values, const ThreadSafeReferenceType* types, size_t count)
+{
+    std::vector<FrozenValue> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        switch (types[i]) {
+        case ThreadSafeReferenceType::Object:
+            result.emplace_back(static_cast<Object*>(values[i])->freeze(realm));
+            break;
+        case ThreadSafeReferenceType::List:
+            result.emplace_back(static_cast<List*>(values[i])->freeze(realm));
+            break;
+        case ThreadSafeReferenceType::Results:
+            result.emplace_back(static_cast<Results*>(values[i])->freeze(realm));
+            break;
+        case ThreadSafeReferenceType::Set:
+            result.emplace_back(static_cast<object_store::Set*>(values[i])->freeze(realm));
+            break;
+        case ThreadSafeReferenceType::Dictionary:
+            result.emplace_back(static_cast<object_store::Dictionary*>(values[i])->freeze(realm));
+            break;
+        default:
+            REALM_UNREACHABLE();
+        }
+    }
+
+    return result;
+}
+
+// Moves each value to the heap and writes its pointer to `results`. Values are only handed out once all of them
+// have been imported, so nothing leaks if an import fails.
+void release_values(std::vector<FrozenValue>& values, void** results)
+{
+    for (size_t i = 0; i < values.size(); ++i) {
+        results[i] = std::visit([](auto& value) -> void* {
+            using T = std::decay_t<decltype(value)>;
+            return new T(std::move(value));
+        }, values[i]);
+    }
+}
+
+} // anonymous namespace
+
+namespace realm::binding {
+
+// Hands over many objects and collections to another thread at once. Where a ThreadSafeReference duplicates the
+// source transaction for every value, the batch freezes the source Realm once and keeps a frozen copy of each
+// value, so a batch pins a single version regardless of its size. Frozen values can be read from any thread, and
+// resolving imports them into the target Realm through freeze(), which imports into whichever Realm it's given.
+class ThreadSafeReferenceBatch {
+public:
+    ThreadSafeReferenceBatch(const SharedRealm& realm, void** values, const ThreadSafeReferenceType* types, size_t count)
+        : m_realm(realm->is_frozen() ? realm : realm->freeze())
+        , m_values(freeze_values(m_realm, values, types, count))
+    {
+    }
+
+    size_t size() const
+    {
+        return m_values.size();
+    }
+
+    // Writes a pointer to each value, imported into `realm`, to `results`. Like ThreadSafeReference, a live Realm
+    // that is behind the batch's version is advanced to the latest version first. Values that were deleted in the
+    // version of `realm` are returned invalid.
+    void resolve(const SharedRealm& realm, void** results)
+    {
+        realm->verify_thread();
+        if (!realm->is_frozen()) {
+            realm->read_group();
+            if (!realm->is_in_transaction() && realm->read_transaction_version() < m_realm->read_transaction_version()) {
+                realm->refresh();
+            }
+        }
+
+        std::vector<FrozenValue> resolved;
+        resolved.reserve(m_values.size());
+        for (auto& value : m_values) {
+            resolved.push_back(std::visit([&](auto& frozen_value) -> FrozenValue {
+                return frozen_value.freeze(realm);
+            }, value));
+        }
+
+        release_values(resolved, results);
+    }
+
+private:
+    // Can be the coordinator's cached frozen Realm, which is shared with the app, so it's never closed. Releasing
+    // it when the batch is destroyed unpins the version.
+    SharedRealm m_realm;
+    std::vector<FrozenValue> m_values;
+};
+
+} // namespace realm::binding
+
+extern "C" {
+
+// Captures `count` objects and collections of `realm`, described by `types`, in a single handover. The values must
+// belong to `realm`, which can't be in a write transaction as values created in it aren't visible to other threads yet.
+REALM_EXPORT ThreadSafeReferenceBatch* thread_safe_reference_batch_create(SharedRealm& realm, void** values, ThreadSafeReferenceType* types, size_t count, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        realm->verify_thread();
+        if (realm->is_in_transaction()) {
+            throw LogicError(ErrorCodes::WrongTransactionState, "Can't hand over a batch of values from within a write transaction.");
+        }
+
+        return new ThreadSafeReferenceBatch(realm, values, types, count);
+    });
+}
+
+REALM_EXPORT size_t thread_safe_reference_batch_size(const ThreadSafeReferenceBatch& batch)
+{
+    return batch.size();
+}
+
+// `results` must have room for thread_safe_reference_batch_size pointers. A batch can be resolved more than once
+// and keeps its version pinned until it's destroyed.
+REALM_EXPORT void thread_safe_reference_batch_resolve(ThreadSafeReferenceBatch& batch, SharedRealm& realm, void** results, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        batch.resolve(realm, results);
+    });
+}
+
+REALM_EXPORT void thread_safe_reference_batch_destroy(ThreadSafeReferenceBatch* batch)
+{
+    delete batch;
+}
+
+// Freezes `count` live objects and collections, described by `types`, against a single frozen Realm and writes a
+// pointer to each frozen value to `results`. Unlike freezing them one by one, the frozen Realm is looked up once.
+REALM_EXPORT void shared_realm_freeze_many(const SharedRealm& frozen_realm, void** values, ThreadSafeReferenceType* types, size_t count, void** results, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        if (!frozen_realm->is_frozen()) {
+            throw InvalidArgument(ErrorCodes::InvalidArgument, "Values can only be frozen against a frozen Realm.");
+        }
+
+        auto frozen_values = freeze_values(frozen_realm, values, types, count);
+        release_values(frozen_values, results);
+    });
+}
+
+}   // extern "C"
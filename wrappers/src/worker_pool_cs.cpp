@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include "worker_pool_cs.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+using namespace realm::binding;
+
+namespace {
+
+// The part of a parallel_for shared with the pool jobs, which may only start running after it has returned.
+struct ParallelForState {
+    ParallelForState(size_t count, const std::function<void(size_t)>& body)
+        : count(count)
+        , body(body)
+    {
+    }
+
+    const size_t count;
+    const std::function<void(size_t)>& body;
+    std::atomic<size_t> next{0};
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t completed = 0;
+    std::exception_ptr error;
+
+    // Runs the indices that are still unclaimed. `body` is only touched for claimed indices, which parallel_for
+    // waits for, so it's fine for jobs to outlive the call once there's nothing left to claim.
+    void run()
+    {
+        for (size_t i = next++; i < count; i = next++) {
+            std::exception_ptr failure;
+            try {
+                body(i);
+            }
+            catch (...) {
+                failure = std::current_exception();
+            }
+
+            std::lock_guard lock(mutex);
+            if (failure && !error) {
+                error = failure;
+            }
+            if (++completed == count) {
+                condition.notify_all();
+            }
+        }
+    }
+};
+
+} // anonymous namespace
+
+namespace realm::binding {
+
+WorkerPool& WorkerPool::shared()
+{
+    // Leaked, so that the threads never have to be joined during static destruction.
+    static WorkerPool* pool = new WorkerPool(std::max(1u, std::thread::hardware_concurrency()));
+    return *pool;
+}
+
+WorkerPool::WorkerPool(size_t thread_count)
+{
+    m_threads.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        m_threads.emplace_back([this] { run(); });
+    }
+}
+
+void WorkerPool::submit(std::function<void()> job)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+    }
+    m_condition.notify_one();
+}
+
+void WorkerPool::run()
+{
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [&] { return !m_jobs.empty(); });
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        job();
+    }
+}
+
+void WorkerPool::parallel_for(size_t count, const std::function<void(size_t)>& body)
+{
+    if (count == 0) {
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>(count, body);
+    const size_t helpers = std::min(count - 1, thread_count());
+    for (size_t i = 0; i < helpers; ++i) {
+        submit([state] { state->run(); });
+    }
+
+    state->run();
+
+    std::unique_lock lock(state->mutex);
+    state->condition.wait(lock, [&] { return state->completed == count; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+} // namespace realm::binding
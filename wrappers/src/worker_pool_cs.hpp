@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace realm::binding {
+
+// A process-wide pool of native threads, one per hardware thread, for work that must not block the thread that
+// requested it, such as evaluating queries against frozen Realms. Jobs must not call back into managed code other
+// than to complete a task, as that would tie up a pool thread for as long as the managed code runs.
+class WorkerPool {
+public:
+    static WorkerPool& shared();
+
+    size_t thread_count() const
+    {
+        return m_threads.size();
+    }
+
+    // The job must handle its own errors, as nothing on a pool thread can catch them.
+    void submit(std::function<void()> job);
+
+    // Runs body(i) for every i in [0, count) on the pool and the calling thread, and returns once all of them have
+    // run, rethrowing the first exception any of them threw. The calling thread takes work as well, so this doesn't
+    // depend on pool threads being free and can be called from a pool job.
+    void parallel_for(size_t count, const std::function<void(size_t)>& body);
+
+private:
+    explicit WorkerPool(size_t thread_count);
+
+    void run();
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<std::function<void()>> m_jobs;
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace realm::binding
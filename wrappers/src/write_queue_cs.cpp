@@ -0,0 +1,353 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2025 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/object-store/util/scheduler.hpp>
+
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace realm::binding {
+
+enum class queued_mutation_type : uint8_t {
+    // Starts a new object in the table. If `value` isn't null (or the table has a nullable primary key), it is used as
+    // the primary key and an existing object with that key is updated instead.
+    CreateObject,
+
+    // Sets the property at `property_index` of the object started by the last CreateObject.
+    SetValue,
+};
+
+struct queued_mutation {
+    queued_mutation_type type;
+    TableKey table_key;
+    size_t property_index;
+    realm_value_t value;
+};
+
+// A batch of mutations enqueued by a producer. Strings and binary values are copied into `storage`, as the
+// batch outlives the call that enqueued it.
+struct MutationBatch {
+    struct Mutation {
+        queued_mutation_type type;
+        TableKey table_key;
+        ColKey column_key;
+        Mixed value;
+    };
+
+    std::vector<Mutation> mutations;
+    std::deque<std::string> storage;
+    void* task_completion_source;
+};
+
+// Applies batches of mutations enqueued from any number of threads on a single writer thread with its own Realm.
+// All batches waiting when the writer wakes up are applied in a single write transaction, and each batch's task
+// is completed once that transaction is committed. If a batch fails, the transaction is rolled back and the
+// batches are retried one transaction each, so that only the failing batch reports the error.
+//
+// The writer thread keeps the queue alive, so the queue can be released without waiting for it: close() applies
+// the pending batches and joins the thread, while stop() only tells the thread to exit once they're applied.
+class WriteQueue : public std::enable_shared_from_this<WriteQueue> {
+public:
+    WriteQueue(const SharedRealm& realm)
+        : m_config(realm->config())
+        , m_schema(realm->schema())
+    {
+        m_config.cache = false;
+
+        // The writer thread must not call back into managed code, and the file has already been migrated and initialized.
+        m_config.migration_function = nullptr;
+        m_config.initialization_function = nullptr;
+        m_config.should_compact_on_launch_function = nullptr;
+    }
+
+    void start()
+    {
+        m_thread = std::thread([self = shared_from_this()]() {
+            self->run();
+        });
+    }
+
+    // Blocks until the batches enqueued so far have been applied.
+    void close()
+    {
+        request_stop();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+
+    // Lets the writer thread exit on its own once the batches enqueued so far have been applied.
+    void stop()
+    {
+        request_stop();
+        if (m_thread.joinable()) {
+            m_thread.detach();
+        }
+    }
+
+    void enqueue(const queued_mutation* mutations, size_t count, void* task_completion_source)
+    {
+        auto batch = std::make_unique<MutationBatch>();
+        batch->mutations.reserve(count);
+        batch->task_completion_source = task_completion_source;
+
+        const ObjectSchema* object_schema = nullptr;
+        for (size_t i = 0; i < count; ++i) {
+            const queued_mutation& mutation = mutations[i];
+            if (mutation.type == queued_mutation_type::CreateObject) {
+                auto it = m_schema.find(mutation.table_key);
+                if (it == m_schema.end()) {
+                    throw InvalidArgument(ErrorCodes::NoSuchTable, util::format("No object type with table key %1 exists in the schema.", mutation.table_key.value));
+                }
+                object_schema = &*it;
+                batch->mutations.push_back({ mutation.type, mutation.table_key, ColKey(), copy_value(*batch, mutation.value) });
+                continue;
+            }
+
+            if (!object_schema) {
+                throw InvalidArgument(ErrorCodes::InvalidArgument, "A value can only be set after an object was created in the batch.");
+            }
+
+            const Property& property = object_schema->persisted_properties.at(mutation.property_index);
+            const auto& value = mutation.value;
+            if (is_collection(property.type) || value.type == realm_value_type::RLM_TYPE_LINK) {
+                throw InvalidArgument(ErrorCodes::InvalidProperty, util::format("Property '%1.%2' can't be set through a write queue as links and collections are not supported.", object_schema->name, property.name));
+            }
+
+            if (value.is_null() && !is_nullable(property.type)) {
+                throw NotNullable(object_schema->name, property.name);
+            }
+
+            if (!value.is_null() && (property.type & ~PropertyType::Flags) != PropertyType::Mixed && to_capi(property.type) != value.type) {
+                throw PropertyTypeMismatchException(object_schema->name, property.name, to_string(property.type), to_string(value.type));
+            }
+
+            batch->mutations.push_back({ mutation.type, object_schema->table_key, property.column_key, copy_value(*batch, value) });
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_stopping) {
+                throw LogicError(ErrorCodes::ClosedRealm, "The write queue has been disposed.");
+            }
+            m_pending.push_back(std::move(batch));
+        }
+        m_condition.notify_one();
+    }
+
+private:
+    Realm::Config m_config;
+    const Schema m_schema;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<std::unique_ptr<MutationBatch>> m_pending;
+    bool m_stopping = false;
+
+    std::thread m_thread;
+
+    void request_stop()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_condition.notify_one();
+    }
+
+    static Mixed copy_value(MutationBatch& batch, const realm_value_t& value)
+    {
+        Mixed result = from_capi(value);
+        if (result.is_type(type_String)) {
+            const StringData string = result.get_string();
+            const auto& copy = batch.storage.emplace_back(string.data(), string.size());
+            result = Mixed(StringData(copy.data(), copy.size()));
+        }
+        else if (result.is_type(type_Binary)) {
+            const BinaryData binary = result.get_binary();
+            const auto& copy = batch.storage.emplace_back(binary.data(), binary.size());
+            result = Mixed(BinaryData(copy.data(), copy.size()));
+        }
+
+        return result;
+    }
+
+    void run()
+    {
+        SharedRealm realm;
+        try {
+            // A generic scheduler is bound to the thread that creates it, so it's created on the writer thread.
+            Realm::Config config = m_config;
+            config.scheduler = util::Scheduler::make_generic();
+            realm = Realm::get_shared_realm(std::move(config));
+        }
+        catch (...) {
+            fail_pending(std::current_exception());
+            return;
+        }
+
+        while (true) {
+            std::vector<std::unique_ptr<MutationBatch>> batches;
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [&] { return m_stopping || !m_pending.empty(); });
+                if (m_pending.empty()) {
+                    break;
+                }
+                batches.swap(m_pending);
+            }
+
+            try {
+                realm->begin_transaction();
+                for (const auto& batch : batches) {
+                    apply(realm, *batch);
+                }
+                realm->commit_transaction();
+                for (const auto& batch : batches) {
+                    complete(*batch, nullptr);
+                }
+            }
+            catch (...) {
+                if (realm->is_in_transaction()) {
+                    realm->cancel_transaction();
+                }
+                apply_one_by_one(realm, batches);
+            }
+        }
+
+        realm->close();
+    }
+
+    void apply_one_by_one(const SharedRealm& realm, const std::vector<std::unique_ptr<MutationBatch>>& batches)
+    {
+        for (const auto& batch : batches) {
+            try {
+                realm->begin_transaction();
+                apply(realm, *batch);
+                realm->commit_transaction();
+                complete(*batch, nullptr);
+            }
+            catch (...) {
+                if (realm->is_in_transaction()) {
+                    realm->cancel_transaction();
+                }
+                complete(*batch, std::current_exception());
+            }
+        }
+    }
+
+    static void apply(const SharedRealm& realm, const MutationBatch& batch)
+    {
+        Obj obj;
+        for (const auto& mutation : batch.mutations) {
+            if (mutation.type == queued_mutation_type::CreateObject) {
+                const TableRef table = get_table(realm, mutation.table_key);
+                obj = table->get_primary_key_column() ? table->create_object_with_primary_key(mutation.value) : table->create_object();
+            }
+            else {
+                obj.set_any(mutation.column_key, mutation.value);
+            }
+        }
+    }
+
+    static void complete(const MutationBatch& batch, std::exception_ptr error)
+    {
+        NativeException::Marshallable nativeEx{ ErrorCodes::Error::OK };
+        if (error) {
+            nativeEx = convert_exception(error).for_marshalling();
+        }
+
+        // The writer thread has no SynchronizationContext, so the managed side is responsible for
+        // not running continuations inline.
+        s_handle_task_completion(batch.task_completion_source, /* invoke_async */ false, nativeEx);
+    }
+
+    void fail_pending(std::exception_ptr error)
+    {
+        while (true) {
+            std::vector<std::unique_ptr<MutationBatch>> batches;
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [&] { return m_stopping || !m_pending.empty(); });
+                if (m_pending.empty()) {
+                    return;
+                }
+                batches.swap(m_pending);
+            }
+
+            for (const auto& batch : batches) {
+                complete(*batch, error);
+            }
+        }
+    }
+};
+
+} // namespace realm::binding
+
+extern "C" {
+
+REALM_EXPORT std::shared_ptr<WriteQueue>* write_queue_create(SharedRealm& realm, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        realm->verify_thread();
+        if (realm->is_frozen() || realm->config().immutable()) {
+            throw LogicError(ErrorCodes::WrongTransactionState, "Can't create a write queue for a read-only or frozen Realm.");
+        }
+
+        auto queue = std::make_shared<WriteQueue>(realm);
+        queue->start();
+        return new std::shared_ptr<WriteQueue>(std::move(queue));
+    });
+}
+
+// Blocks until the batches enqueued so far have been applied. Enqueueing after the queue was closed fails.
+REALM_EXPORT void write_queue_close(std::shared_ptr<WriteQueue>& queue)
+{
+    queue->close();
+}
+
+// Doesn't block. If the queue wasn't closed, the writer thread applies the pending batches and exits on its own.
+REALM_EXPORT void write_queue_destroy(std::shared_ptr<WriteQueue>* queue)
+{
+    (*queue)->stop();
+    delete queue;
+}
+
+// Can be called from any thread. The batch is validated against the schema before it's enqueued, so type errors are
+// reported synchronously. Errors applying the batch complete the task at `tcs_ptr` instead.
+REALM_EXPORT void write_queue_enqueue(std::shared_ptr<WriteQueue>& queue, queued_mutation* mutations, size_t count, void* tcs_ptr, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        queue->enqueue(mutations, count, tcs_ptr);
+    });
+}
+
+}   // extern "C"